@@ -32,13 +32,23 @@ list (APPEND MAIN_SOURCE_FILES
   opm/grid/cpgrid/Intersection.cpp
   opm/grid/cpgrid/CpGridData.cpp
   opm/grid/cpgrid/CpGrid.cpp
+  opm/grid/cpgrid/binaryGridFormat.cpp
   opm/grid/cpgrid/GridHelpers.cpp
   opm/grid/cpgrid/PartitionTypeIndicator.cpp
   opm/grid/cpgrid/processEclipseFormat.cpp
   opm/grid/cpgrid/readSintefLegacyFormat.cpp
+  opm/grid/cpgrid/reorderForLocality.cpp
+  opm/grid/cpgrid/unstructuredGridConversion.cpp
   opm/grid/cpgrid/writeSintefLegacyFormat.cpp
+  opm/grid/common/CartesianArrayOutput.cpp
+  opm/grid/common/EGridReader.cpp
   opm/grid/common/GeometryHelpers.cpp
   opm/grid/common/GridPartitioning.cpp
+  opm/grid/common/NodeSharedGrdecl.cpp
+  opm/grid/common/NodeSharedGlobalGrid.cpp
+  opm/grid/common/NodeTopology.cpp
+  opm/grid/common/PartitionCache.cpp
+  opm/grid/common/UnstructuredGridDistribution.cpp
   opm/grid/common/WellConnections.cpp
   opm/grid/common/ZoltanGraphFunctions.cpp
   opm/grid/common/ZoltanPartition.cpp
@@ -47,6 +57,7 @@ list (APPEND MAIN_SOURCE_FILES
   opm/grid/GridUtilities.cpp
   opm/grid/cart_grid.c
   opm/grid/cornerpoint_grid.c
+  opm/grid/grid_file.c
   opm/grid/cpgpreprocess/facetopology.c
   opm/grid/cpgpreprocess/geometry.c
   opm/grid/cpgpreprocess/preprocess.c
@@ -55,15 +66,12 @@ list (APPEND MAIN_SOURCE_FILES
   opm/grid/grid_equal.cpp
   opm/grid/utility/compressedToCartesian.cpp
   opm/grid/utility/StopWatch.cpp
+  opm/grid/utility/SyntheticCornerPointModel.cpp
   opm/grid/utility/WachspressCoord.cpp
+  opm/grid/utility/VelocityInterpolation.cpp
+  opm/grid/transmissibility/trans_tpfa.c
   )
 
-if (opm-common_FOUND)
-  list(APPEND MAIN_SOURCE_FILES
-		opm/grid/utility/VelocityInterpolation.cpp
-		opm/grid/transmissibility/trans_tpfa.c)
-endif()
-
 if(HAVE_ECL_INPUT)
   list(APPEND MAIN_SOURCE_FILES opm/grid/utility/extractPvtTableIndex.cpp)
 endif()
@@ -84,21 +92,29 @@ list (APPEND ATTIC_FILES
 list (APPEND TEST_SOURCE_FILES
   tests/test_cartgrid.cpp
   tests/test_column_extract.cpp
+  tests/cpgrid/binaryformat_test.cpp
   tests/cpgrid/distribution_test.cpp
+  tests/cpgrid/egridreader_test.cpp
   tests/cpgrid/entityrep_test.cpp
   tests/cpgrid/entity_test.cpp
   tests/cpgrid/facetag_test.cpp
   tests/cpgrid/geometry_test.cpp
   tests/cpgrid/orientedentitytable_test.cpp
   tests/cpgrid/partition_iterator_test.cpp
+  tests/cpgrid/reorder_test.cpp
+  tests/cpgrid/unstructuredgridview_test.cpp
   tests/cpgrid/zoltan_test.cpp
   tests/test_geom2d.cpp
+  tests/test_grid_file.cpp
   tests/test_gridutilities.cpp
   tests/test_minpvprocessor.cpp
 #	tests/grid_test.cc
   tests/p2pcommunicator_test.cc
   tests/test_repairzcorn.cpp
   tests/test_sparsetable.cpp
+  tests/test_syntheticcornerpointmodel.cpp
+  tests/test_unstructuredgriddistribution.cpp
+  tests/test_polyhedralgrid_distribution.cpp
   tests/test_quadratures.cpp
 	)
 
@@ -133,13 +149,26 @@ if(HAVE_ECL_INPUT)
   list(APPEND EXAMPLE_SOURCE_FILES examples/grdecl2vtu.cpp)
   list(APPEND PROGRAM_SOURCE_FILES examples/grdecl2vtu.cpp)
 endif()
+list(APPEND EXAMPLE_SOURCE_FILES examples/cpgrid_benchmark.cpp)
+list(APPEND EXAMPLE_SOURCE_FILES examples/polyhedralgrid_benchmark.cpp)
+# MPI benchmark living next to the distribution test; built but not run as a test.
+list(APPEND EXAMPLE_SOURCE_FILES tests/cpgrid/distribution_benchmark.cpp)
 
 # originally generated with the command:
 # find dune -name '*.h*' -a ! -name '*-pch.hpp' -printf '\t%p\n' | sort
 list (APPEND PUBLIC_HEADER_FILES
+  opm/grid/common/AsyncCellGather.hpp
+  opm/grid/common/CartesianArrayOutput.hpp
+  opm/grid/common/EGridReader.hpp
   opm/grid/common/GeometryHelpers.hpp
   opm/grid/common/GridAdapter.hpp
   opm/grid/common/GridPartitioning.hpp
+  opm/grid/common/NodeSharedArray.hpp
+  opm/grid/common/NodeSharedGrdecl.hpp
+  opm/grid/common/NodeSharedGlobalGrid.hpp
+  opm/grid/common/NodeTopology.hpp
+  opm/grid/common/PartitionCache.hpp
+  opm/grid/common/UnstructuredGridDistribution.hpp
   opm/grid/common/Volumes.hpp
   opm/grid/common/p2pcommunicator.hh
   opm/grid/common/p2pcommunicator_impl.hh
@@ -157,10 +186,15 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/cpgrid/Indexsets.hpp
   opm/grid/cpgrid/Intersection.hpp
   opm/grid/cpgrid/Iterators.hpp
+  opm/grid/cpgrid/MemoryUsage.hpp
+  opm/grid/cpgrid/NonNeighbourConnection.hpp
   opm/grid/cpgrid/OrientedEntityTable.hpp
   opm/grid/cpgrid/PartitionIteratorRule.hpp
+  opm/grid/cpgrid/PartitionQuality.hpp
+  opm/grid/cpgrid/PhaseTimings.hpp
   opm/grid/cpgrid/PartitionTypeIndicator.hpp
   opm/grid/cpgrid/PersistentContainer.hpp
+  opm/grid/cpgrid/UnstructuredGridView.hpp
   opm/grid/common/CartesianIndexMapper.hpp
   opm/grid/common/WellConnections.hpp
   opm/grid/common/ZoltanGraphFunctions.hpp
@@ -195,6 +229,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/RepairZCORN.hpp
   opm/grid/cart_grid.h
   opm/grid/cornerpoint_grid.h
+  opm/grid/grid_file.h
   opm/grid/cpgpreprocess/facetopology.h
   opm/grid/cpgpreprocess/geometry.h
   opm/grid/cpgpreprocess/preprocess.h
@@ -208,6 +243,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/grid/utility/RegionMapping.hpp
   opm/grid/utility/SparseTable.hpp
   opm/grid/utility/StopWatch.hpp
+  opm/grid/utility/SyntheticCornerPointModel.hpp
   opm/grid/utility/VelocityInterpolation.hpp
   opm/grid/utility/WachspressCoord.hpp
   opm/grid/utility/ErrorMacros.hpp
@@ -0,0 +1,242 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/transmissibility/TransTpfa.hpp>
+#include <opm/grid/utility/BenchmarkUtilities.hpp>
+#include <opm/grid/utility/SyntheticCornerPointModel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @file cpgrid_benchmark.cpp
+ * @brief Benchmark of CpGrid on synthetic corner-point models
+ *
+ * Times the processing of the corner-point input, the computation of
+ * TPFA transmissibilities, the iteration over the cells and their
+ * intersections, and the load balancing for models of increasing size.
+ * The results are written as JSON.
+ *
+ * Usage: cpgrid_benchmark [key=value ...] with the keys
+ *   cells              comma separated list of model sizes (default 1000000)
+ *   nz                 number of layers (default 20)
+ *   fault_density      probability that a line of pillars is a fault (default 0.1)
+ *   fault_throw        fault throw in layers (default 0.5)
+ *   pinchout_fraction  probability of a pinched layer at a pillar (default 0.01)
+ *   inactive_fraction  probability of an inactive cell (default 0.05)
+ *   pillar_slope       horizontal pillar displacement per height (default 0.1)
+ *   seed               seed of the random number generator (default 0)
+ *   output             JSON file to write (default: standard output)
+ *
+ * Models with 100M cells need on the order of 100 GB of memory.
+ */
+
+namespace
+{
+
+    using Opm::Benchmark::Clock;
+    using Opm::Benchmark::parseArguments;
+    using Opm::Benchmark::secondsSince;
+
+    double getDouble(const std::map<std::string, std::string>& args,
+                     const std::string& key, double default_value)
+    {
+        auto it = args.find(key);
+        return it == args.end() ? default_value : std::atof(it->second.c_str());
+    }
+
+    std::vector<long> getSizes(const std::map<std::string, std::string>& args)
+    {
+        std::vector<long> sizes;
+        auto it = args.find("cells");
+        std::istringstream list(it == args.end() ? std::string("1000000") : it->second);
+        std::string size;
+        while (std::getline(list, size, ',')) {
+            sizes.push_back(std::atol(size.c_str()));
+        }
+        return sizes;
+    }
+
+    /// A JSON object with numbers, written in insertion order.
+    class JsonObject
+    {
+    public:
+        void add(const std::string& key, double value)
+        {
+            std::ostringstream os;
+            os.precision(10);
+            os << value;
+            entries_.push_back("\"" + key + "\": " + os.str());
+        }
+        void addRaw(const std::string& key, const std::string& json)
+        {
+            entries_.push_back("\"" + key + "\": " + json);
+        }
+        std::string str(const std::string& indent) const
+        {
+            std::string json = "{";
+            for (std::size_t i = 0; i < entries_.size(); ++i) {
+                json += (i == 0 ? "\n" : ",\n") + indent + "  " + entries_[i];
+            }
+            return json + "\n" + indent + "}";
+        }
+    private:
+        std::vector<std::string> entries_;
+    };
+
+    std::string benchmarkCase(Opm::SyntheticCornerPointParameters params)
+    {
+        JsonObject result;
+        JsonObject timings;
+
+        auto start = Clock::now();
+        Opm::SyntheticCornerPointModel model(params);
+        timings.add("generate", secondsSince(start));
+
+        Dune::CpGrid grid;
+        start = Clock::now();
+        grid.processEclipseFormat(model.input(), 0.0, false);
+        timings.add("processEclipseFormat", secondsSince(start));
+
+        const int num_cells = grid.numCells();
+        std::vector<double> perm(9*num_cells, 0.0);
+        for (int c = 0; c < num_cells; ++c) {
+            perm[9*c] = perm[9*c + 4] = perm[9*c + 8] = 1.0;
+        }
+        std::vector<double> htrans(grid.numCellFaces());
+        std::vector<double> trans(grid.numFaces());
+        start = Clock::now();
+        tpfa_htrans_compute(&grid, perm.data(), htrans.data());
+        tpfa_trans_compute(&grid, htrans.data(), trans.data());
+        timings.add("TransTpfa", secondsSince(start));
+
+        const auto& view = grid.leafGridView();
+        double volume = 0.0;
+        start = Clock::now();
+        for (auto it = view.begin<0>(), end = view.end<0>(); it != end; ++it) {
+            volume += it->geometry().volume();
+        }
+        timings.add("cellIteration", secondsSince(start));
+
+        double area = 0.0;
+        start = Clock::now();
+        for (auto it = view.begin<0>(), end = view.end<0>(); it != end; ++it) {
+            for (auto is = view.ibegin(*it), iend = view.iend(*it); is != iend; ++is) {
+                if (is->neighbor()) {
+                    area += is->geometry().volume();
+                }
+            }
+        }
+        timings.add("intersectionTraversal", secondsSince(start));
+
+        const auto global_memory = grid.memoryUsage().global_view.total();
+        start = Clock::now();
+        grid.loadBalance();
+        timings.add("loadBalance", secondsSince(start));
+
+        JsonObject parameters;
+        parameters.add("nx", params.dims[0]);
+        parameters.add("ny", params.dims[1]);
+        parameters.add("nz", params.dims[2]);
+        parameters.add("fault_density", params.fault_density);
+        parameters.add("fault_throw", params.fault_throw);
+        parameters.add("pinchout_fraction", params.pinchout_fraction);
+        parameters.add("inactive_fraction", params.inactive_fraction);
+        parameters.add("pillar_slope", params.pillar_slope);
+        parameters.add("seed", params.seed);
+
+        JsonObject phases;
+        const auto phase_timings = grid.phaseTimings();
+        for (int i = 0; i < Dune::cpgrid::numGridPhases; ++i) {
+            const auto phase = static_cast<Dune::cpgrid::GridPhase>(i);
+            phases.add(Dune::cpgrid::gridPhaseName(phase), phase_timings.seconds(phase));
+        }
+
+        result.addRaw("parameters", parameters.str("    "));
+        result.add("active_cells", num_cells);
+        result.add("faces", grid.numFaces());
+        result.add("vertices", grid.numVertices());
+        result.add("total_volume", volume);
+        result.add("interior_area", area);
+        result.add("global_grid_bytes", global_memory);
+        result.addRaw("seconds", timings.str("    "));
+        result.addRaw("phase_seconds", phases.str("    "));
+        return result.str("  ");
+    }
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+try
+{
+    Dune::MPIHelper::instance(argc, argv);
+    const int rank = Dune::MPIHelper::getCollectiveCommunication().rank();
+    const auto args = parseArguments(argc, argv);
+
+    Opm::SyntheticCornerPointParameters params;
+    params.cellsize = {{ 100.0, 100.0, 2.0 }};
+    params.fault_density = getDouble(args, "fault_density", 0.1);
+    params.fault_throw = getDouble(args, "fault_throw", 0.5);
+    params.pinchout_fraction = getDouble(args, "pinchout_fraction", 0.01);
+    params.inactive_fraction = getDouble(args, "inactive_fraction", 0.05);
+    params.pillar_slope = getDouble(args, "pillar_slope", 0.1);
+    params.seed = static_cast<unsigned int>(getDouble(args, "seed", 0));
+    const int nz = static_cast<int>(getDouble(args, "nz", 20));
+
+    std::vector<std::string> cases;
+    for (long size : getSizes(args)) {
+        const int nxy = std::max(1, static_cast<int>(std::sqrt(double(size) / nz)));
+        params.dims = {{ nxy, nxy, nz }};
+        cases.push_back(benchmarkCase(params));
+    }
+
+    std::ostringstream json;
+    json << "{\n  \"benchmark\": \"cpgrid\",\n  \"ranks\": "
+         << Dune::MPIHelper::getCollectiveCommunication().size()
+         << ",\n  \"cases\": [";
+    for (std::size_t i = 0; i < cases.size(); ++i) {
+        json << (i == 0 ? "\n  " : ",\n  ") << cases[i];
+    }
+    json << "\n  ]\n}\n";
+
+    if (rank == 0) {
+        auto output = args.find("output");
+        if (output == args.end()) {
+            std::cout << json.str();
+        } else {
+            std::ofstream file(output->second);
+            file << json.str();
+        }
+    }
+    return EXIT_SUCCESS;
+}
+catch (const std::exception& e) {
+    std::cerr << "Program threw an exception: " << e.what() << "\n";
+    throw;
+}
@@ -42,6 +42,10 @@ using namespace Dune;
  * Converts a corner-point grid with properties to a vtu-file
  * (to be opened in ParaView for example)
  *
+ * Run with more than one MPI process, the grid is load balanced and each
+ * process writes the cells it owns as a binary piece. A .pvtu file
+ * references all the pieces.
+ *
  * Based on make_vtk_test.cpp
  *
  * @author H�vard Berland <havb@statoil.com>
@@ -50,6 +54,12 @@ using namespace Dune;
  *
  */
 
+/// Whether this process reports progress.
+bool isIoRank()
+{
+    return Dune::MPIHelper::getCollectiveCommunication().rank() == 0;
+}
+
 /**
    A function to (conditionally) write a double-field from the grdecl-file to vtk-format
 */
@@ -61,8 +71,11 @@ void condWriteDoubleField(std::vector<double>& fieldvector,
                           const std::array<size_t, 3>& dims,
                           VTKWriter<CpGrid::LeafGridView>& vtkwriter) {
     if (deck.hasKeyword(fieldname)) {
-        std::cout << "Found " << fieldname << "..." << std::endl;
-        std::vector<double> eclVector = deck.getKeyword(fieldname).getRawDoubleData();
+        if (isIoRank()) {
+            std::cout << "Found " << fieldname << "..." << std::endl;
+        }
+        // Read by reference, and only the cells of this process are copied.
+        const std::vector<double>& eclVector = deck.getKeyword(fieldname).getRawDoubleData();
         fieldvector.resize(global_cell.size());
         int num_global_cells = dims[0]*dims[1]*dims[2];
         if (int(eclVector.size()) != num_global_cells) {
@@ -88,8 +101,11 @@ void condWriteIntegerField(std::vector<double>& fieldvector,
                            const std::array<size_t, 3>& dims,
                            VTKWriter<CpGrid::LeafGridView>& vtkwriter) {
     if (deck.hasKeyword(fieldname)) {
-        std::cout << "Found " << fieldname << "..." << std::endl;
-        std::vector<int> eclVector = deck.getKeyword(fieldname).getIntData();
+        if (isIoRank()) {
+            std::cout << "Found " << fieldname << "..." << std::endl;
+        }
+        // Read by reference, and only the cells of this process are copied.
+        const std::vector<int>& eclVector = deck.getKeyword(fieldname).getIntData();
         fieldvector.resize(global_cell.size());
         int num_global_cells = dims[0]*dims[1]*dims[2];
         if (int(eclVector.size()) != num_global_cells) {
@@ -115,7 +131,9 @@ try
     CpGrid grid;
 
     if (argc != 2) {
-        std::cout << "Usage: grdecl2vtu filename.grdecl" << std::endl;
+        if (isIoRank()) {
+            std::cout << "Usage: [mpirun -np N] grdecl2vtu filename.grdecl" << std::endl;
+        }
         exit(1);
     }
 
@@ -146,6 +164,12 @@ try
         grid.processEclipseFormat(ecl_grid, false);
     }
 
+    const bool parallel = Dune::MPIHelper::getCollectiveCommunication().size() > 1;
+    if (parallel) {
+        // Each process continues with its part of the grid.
+        grid.loadBalance();
+    }
+
     VTKWriter<CpGrid::LeafGridView> vtkwriter(grid.leafGridView());
 
     const std::vector<int>& global_cell = grid.globalCell();
@@ -175,8 +199,17 @@ try
 
     std::string fname(eclipsefilename);
     std::string fnamebase = fname.substr(0, fname.find_last_of('.'));
-    std::cout << "Writing to filename " << fnamebase << ".vtu" << std::endl;
-    vtkwriter.write(fnamebase, VTK::ascii);
+    if (parallel) {
+        // One piece per process in binary appended format, and a .pvtu
+        // file referencing them.
+        if (isIoRank()) {
+            std::cout << "Writing to filename " << fnamebase << ".pvtu" << std::endl;
+        }
+        vtkwriter.write(fnamebase, VTK::appendedraw);
+    } else {
+        std::cout << "Writing to filename " << fnamebase << ".vtu" << std::endl;
+        vtkwriter.write(fnamebase, VTK::ascii);
+    }
 }
 catch (const std::exception &e) {
     std::cerr << "Program threw an exception: " << e.what() << "\n";
@@ -0,0 +1,161 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/polyhedralgrid.hh>
+#include <opm/grid/cornerpoint_grid.h>
+#include <opm/grid/utility/BenchmarkUtilities.hpp>
+#include <opm/grid/utility/SyntheticCornerPointModel.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @file polyhedralgrid_benchmark.cpp
+ * @brief Benchmark of PolyhedralGrid against CpGrid on the same corner-point input
+ *
+ * Both grids are built from one synthetic corner-point model. For each
+ * grid, the construction, the geometry queries of the cells and the
+ * traversal of the intersections with their inverse index are timed. The
+ * sums of the queried values are printed as well, so the grids can be
+ * seen to agree. The results are written as JSON to standard output.
+ *
+ * Usage: polyhedralgrid_benchmark [key=value ...] with the keys
+ *   nx, ny, nz   dimensions of the model (default 100, 100, 20)
+ *   repeat       number of traversals timed (default 5)
+ *   seed         seed of the random number generator (default 0)
+ */
+
+namespace
+{
+
+    using Opm::Benchmark::Clock;
+    using Opm::Benchmark::parseArguments;
+    using Opm::Benchmark::secondsSince;
+
+    int getInt(const std::map<std::string, std::string>& args,
+               const std::string& key, int default_value)
+    {
+        auto it = args.find(key);
+        return it == args.end() ? default_value : std::atoi(it->second.c_str());
+    }
+
+    /// Time the traversals of a grid view and return them as JSON.
+    template <class GridView>
+    std::string benchmarkView(const GridView& view, int repeat, double construction)
+    {
+        double corner_sum = 0.0, center_sum = 0.0, outside_sum = 0.0;
+        long intersections = 0;
+
+        auto start = Clock::now();
+        for (int r = 0; r < repeat; ++r) {
+            corner_sum = center_sum = 0.0;
+            for (auto it = view.template begin<0>(), end = view.template end<0>(); it != end; ++it) {
+                const auto geometry = it->geometry();
+                for (int i = 0; i < geometry.corners(); ++i) {
+                    corner_sum += geometry.corner(i)[2];
+                }
+                center_sum += geometry.center()[2];
+            }
+        }
+        const double geometry_seconds = secondsSince(start) / repeat;
+
+        start = Clock::now();
+        for (int r = 0; r < repeat; ++r) {
+            outside_sum = 0.0;
+            intersections = 0;
+            for (auto it = view.template begin<0>(), end = view.template end<0>(); it != end; ++it) {
+                for (auto is = view.ibegin(*it), iend = view.iend(*it); is != iend; ++is) {
+                    if (is->neighbor()) {
+                        outside_sum += is->indexInOutside();
+                        ++intersections;
+                    }
+                }
+            }
+        }
+        const double intersection_seconds = secondsSince(start) / repeat;
+
+        std::ostringstream json;
+        json.precision(10);
+        json << "{ \"construction\": " << construction
+             << ", \"cellGeometry\": " << geometry_seconds
+             << ", \"intersectionTraversal\": " << intersection_seconds
+             << ", \"cells\": " << view.size(0)
+             << ", \"interior_intersections\": " << intersections
+             << ", \"corner_z_sum\": " << corner_sum
+             << ", \"center_z_sum\": " << center_sum
+             << ", \"index_in_outside_sum\": " << outside_sum << " }";
+        return json.str();
+    }
+
+    struct UnstructuredGridDeleter
+    {
+        void operator()(UnstructuredGrid* grid) const { destroy_grid(grid); }
+    };
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+try
+{
+    Dune::MPIHelper::instance(argc, argv);
+    const auto args = parseArguments(argc, argv);
+
+    Opm::SyntheticCornerPointParameters params;
+    params.dims = {{ getInt(args, "nx", 100), getInt(args, "ny", 100), getInt(args, "nz", 20) }};
+    params.cellsize = {{ 100.0, 100.0, 2.0 }};
+    params.seed = getInt(args, "seed", 0);
+    const int repeat = std::max(1, getInt(args, "repeat", 5));
+    const Opm::SyntheticCornerPointModel model(params);
+    const grdecl input = model.input();
+
+    auto start = Clock::now();
+    Dune::CpGrid cpgrid;
+    cpgrid.processEclipseFormat(input, 0.0, false);
+    const double cpgrid_construction = secondsSince(start);
+
+    start = Clock::now();
+    std::unique_ptr<UnstructuredGrid, UnstructuredGridDeleter> ug(create_grid_cornerpoint(&input, 0.0));
+    if (!ug) {
+        throw std::runtime_error("Failed to construct the UnstructuredGrid.");
+    }
+    Dune::PolyhedralGrid<3, 3> polygrid(*ug);
+    const double polygrid_construction = secondsSince(start);
+
+    std::cout << "{\n  \"benchmark\": \"polyhedralgrid\",\n"
+              << "  \"dims\": [" << params.dims[0] << ", " << params.dims[1] << ", "
+              << params.dims[2] << "],\n"
+              << "  \"CpGrid\": "
+              << benchmarkView(cpgrid.leafGridView(), repeat, cpgrid_construction) << ",\n"
+              << "  \"PolyhedralGrid\": "
+              << benchmarkView(polygrid.leafGridView(), repeat, polygrid_construction) << "\n}\n";
+    return EXIT_SUCCESS;
+}
+catch (const std::exception& e) {
+    std::cerr << "Program threw an exception: " << e.what() << "\n";
+    throw;
+}
@@ -41,7 +41,9 @@
 #include <string>
 #include <map>
 #include <array>
+#include <functional>
 #include <unordered_set>
+#include <type_traits>
 #include <opm/grid/utility/ErrorMacros.hpp>
 
 // Warning suppression for Dune includes.
@@ -65,13 +67,21 @@
 #include "cpgrid/Iterators.hpp"
 #include "cpgrid/Indexsets.hpp"
 #include "cpgrid/DefaultGeometryPolicy.hpp"
+#include "cpgrid/MemoryUsage.hpp"
+#include "cpgrid/NonNeighbourConnection.hpp"
+#include "cpgrid/PartitionQuality.hpp"
+#include "cpgrid/PhaseTimings.hpp"
 #include "common/Volumes.hpp"
+#include "common/CartesianArrayOutput.hpp"
+#include "common/NodeTopology.hpp"
 #include <opm/grid/cpgpreprocess/preprocess.h>
 
 #include <opm/grid/utility/OpmParserIncludes.hpp>
 
 #include <iostream>
 
+struct UnstructuredGrid;
+
 namespace Dune
 {
 
@@ -80,6 +90,9 @@ namespace Dune
     namespace cpgrid
     {
         class CpGridData;
+        class NodeSharedGlobalGrid;
+        class NodeSharedGrdecl;
+        class UnstructuredGridView;
     }
 
     ////////////////////////////////////////////////////////////////////////
@@ -243,6 +256,33 @@ namespace Dune
         void writeSintefLegacyFormat(const std::string& grid_prefix) const;
 
 
+        /// Read the binary grid format written by writeBinaryFormat().
+        /// Arrays are taken from a memory mapping of the file, and
+        /// checksums are verified.
+        /// \param filename the name of the file to read.
+        void readBinaryFormat(const std::string& filename);
+
+
+        /// Write the binary grid format, an endianness tagged and
+        /// versioned file with one checksummed section per array.
+        /// \param filename the name of the file to write.
+        void writeBinaryFormat(const std::string& filename) const;
+
+
+        /// Build the grid from an UnstructuredGrid of a corner-point grid,
+        /// e.g. of create_grid_cornerpoint(), without processing the
+        /// corner-point input again. The topology and geometry are copied.
+        /// \param grid the grid, which needs cell face tags.
+        void processUnstructuredGrid(const UnstructuredGrid& grid);
+
+
+        /// Describe the current view as an UnstructuredGrid sharing the
+        /// arrays of this grid where possible. Usually called through the
+        /// constructor of cpgrid::UnstructuredGridView.
+        /// \param view the view to fill.
+        void fillUnstructuredGridView(cpgrid::UnstructuredGridView& view) const;
+
+
 #if HAVE_ECL_INPUT
         /// Read the Eclipse grid format ('grdecl').
         /// \param ecl_grid the high-level object from opm-parser which represents the simulation's grid
@@ -263,6 +303,25 @@ namespace Dune
         /// \param remove_ij_boundary if true, will remove (i, j) boundaries. Used internally.
         void processEclipseFormat(const grdecl& input_data, double z_tolerance, bool remove_ij_boundary, bool turn_normals = false);
 
+#if HAVE_MPI
+        /// Read the Eclipse grid format ('grdecl') stored once per node.
+        ///
+        /// Only the first process of each node builds the global grid and
+        /// copies it to the shared memory of the node, from which loadBalance()
+        /// distributes it. Afterwards process 0 keeps the global grid, as it
+        /// partitions it, while the other processes hold an empty global view.
+        /// Hence scatterData() and gatherData() are not available; use
+        /// scatterCellProperty(), writeCartesianCellData() or
+        /// cellScatterGatherInterface() instead. Collective over MPI_COMM_WORLD.
+        /// \param input_data the input, distributed over the same processes
+        ///        as MPI_COMM_WORLD.
+        /// \param z_tolerance see the overload above.
+        /// \param remove_ij_boundary see the overload above.
+        /// \param turn_normals see the overload above.
+        void processEclipseFormat(const cpgrid::NodeSharedGrdecl& input_data, double z_tolerance,
+                                  bool remove_ij_boundary, bool turn_normals = false);
+#endif
+
         //@}
 
         /// \name Cartesian grid extensions.
@@ -325,6 +384,102 @@ namespace Dune
             current_view_data_->setUniqueBoundaryIds(uids);
         }
 
+        /// \brief Renumber cells, faces and points to improve memory locality.
+        ///
+        /// The cells are ordered by reverse Cuthill-McKee on the graph of
+        /// face neighbours. Faces and points are numbered in the order they
+        /// are first reached from the cells. This benefits assembly and
+        /// linear solvers that inherit the grid ordering. globalCell() is
+        /// permuted accordingly and no longer sorted.
+        /// Must be called before loadBalance().
+        void reorderForLocality();
+
+        /// \brief Get the indices entities had before reorderForLocality().
+        /// \param codim The codimension of the entities (0, 1, or 3).
+        /// \return originalIndices(codim)[i] is the index that entity i had
+        ///         before the renumbering. Empty if the grid was not renumbered.
+        const std::vector<int>& originalIndices(int codim) const
+        {
+            return current_view_data_->originalIndices(codim);
+        }
+
+        /// \brief Estimate the memory used by the grid.
+        ///
+        /// The estimate is broken down into the components of the global
+        /// and the distributed view and is local to this process. Use
+        /// GridMemoryUsage::sum() or GridMemoryUsage::max() with comm() to
+        /// aggregate it over all processes.
+        /// \return The memory used in bytes.
+        cpgrid::GridMemoryUsage memoryUsage() const;
+
+        /// \brief Get the time spent in the phases of grid construction
+        ///        and distribution on this process.
+        ///
+        /// Covers the processing of the corner-point input and, after
+        /// loadBalance(), the partitioning and the setup of the distributed view.
+        cpgrid::PhaseTimings phaseTimings() const;
+
+        /// \brief Get the minimum, maximum and average phase timings over
+        ///        all processes.
+        ///
+        /// Collective over MPI_COMM_WORLD, i.e. has to be called on all processes.
+        cpgrid::PhaseTimingReport phaseTimingReport() const;
+
+        /// \brief Get the quality measures of the partition computed by
+        ///        the last loadBalance().
+        ///
+        /// The report is the same on all processes of the distributed grid.
+        const cpgrid::PartitionQualityReport& partitionQualityReport() const
+        {
+            return partition_quality_;
+        }
+
+        /// \brief Set a file to reuse the partition of earlier runs.
+        ///
+        /// If the file holds a partition computed for the same grid, wells,
+        /// non-neighbour connections, transmissibilities and number of
+        /// processes, loadBalance() uses it instead of partitioning the grid.
+        /// Otherwise the computed partition is written to the file.
+        /// An empty name (the default) disables this.
+        /// \param filename The name of the partition file.
+        void setPartitionFile(const std::string& filename)
+        {
+            partition_file_ = filename;
+        }
+
+        /// \brief Choose whether loadBalance() partitions among the nodes first.
+        ///
+        /// If enabled, the grid is partitioned into one part per node,
+        /// minimizing the cut between nodes, and each of them among the
+        /// processes on that node. Processes sharing memory according to
+        /// MPI_Comm_split_type are on the same node. Requires Zoltan,
+        /// otherwise the setting is ignored.
+        /// \param node_aware Whether to partition hierarchically.
+        void setNodeAwarePartitioning(bool node_aware)
+        {
+            node_aware_partitioning_ = node_aware;
+        }
+
+        /// \brief Write the distributed grid to a checkpoint directory.
+        ///
+        /// Each process writes its view, including the index sets, remote
+        /// indices, global ids and partition types, to its own file in the
+        /// directory, which is created if needed. Collective, and only
+        /// possible after loadBalance().
+        /// \param directory The name of the checkpoint directory.
+        void writeCheckpoint(const std::string& directory) const;
+
+        /// \brief Restore a distributed grid from a checkpoint directory.
+        ///
+        /// Each process reads its file written by writeCheckpoint() with the
+        /// same number of processes, and the distributed view becomes the
+        /// current one. The global grid is neither needed nor built, and
+        /// no partitioning or overlap computation takes place. Hence
+        /// scatterData() and gatherData() are not available afterwards.
+        /// Collective.
+        /// \param directory The name of the checkpoint directory.
+        void readCheckpoint(const std::string& directory);
+
         // --- Dune interface below ---
 
         /// \name The DUNE grid interface implementation
@@ -598,7 +753,7 @@ namespace Dune
         bool loadBalance(int overlapLayers=1)
         {
             using std::get;
-            return get<0>(scatterGrid(nullptr, nullptr, overlapLayers ));
+            return get<0>(scatterGrid(nullptr, nullptr, nullptr, overlapLayers ));
         }
 
         // loadbalance is not part of the grid interface therefore we skip it.
@@ -609,8 +764,8 @@ namespace Dune
         ///            of the last scheduler step of the eclipse state will be
         ///            used to make sure that all the possible completion cells
         ///            of each well are stored on one process. This done by
-        ///            adding an edge with a very high edge weight for all
-        ///            possible pairs of cells in the completion set of a well.
+        ///            contracting the completion cells of a well to one
+        ///            vertex of the partitioning graph.
         /// \param The number of layers of cells of the overlap region (default: 1).
         /// \warning May only be called once.
         std::pair<bool, std::unordered_set<std::string> >
@@ -618,7 +773,29 @@ namespace Dune
                     const double* transmissibilities = nullptr,
                     int overlapLayers=1)
         {
-            return scatterGrid(wells, transmissibilities, overlapLayers);
+            return scatterGrid(wells, transmissibilities, nullptr, overlapLayers);
+        }
+
+        /// \brief Distributes this grid over the available nodes in a distributed machine,
+        ///        taking non-neighbour connections into account.
+        ///
+        /// The connections become edges of the partitioning graph, weighted by their
+        /// transmissibility like the faces. Each cell that is connected to an owned
+        /// cell by one of them is added to the overlap, hence the flux of the
+        /// connections can be computed without further communication.
+        /// \param wells The wells to keep on one process, or null.
+        /// \param transmissibilities The transmissibilities of the faces, or null.
+        /// \param nncs The non-neighbour connections with logical Cartesian cell
+        ///        indices. Connections involving inactive cells are ignored.
+        /// \param overlapLayers The number of layers of cells of the overlap region.
+        /// \warning May only be called once.
+        std::pair<bool, std::unordered_set<std::string> >
+        loadBalance(const std::vector<const cpgrid::OpmWellType *> * wells,
+                    const double* transmissibilities,
+                    const std::vector<cpgrid::NonNeighbourConnection>& nncs,
+                    int overlapLayers=1)
+        {
+            return scatterGrid(wells, transmissibilities, &nncs, overlapLayers);
         }
 
         /// \brief Distributes this grid and data over the available nodes in a distributed machine.
@@ -765,33 +942,18 @@ namespace Dune
         /// cell being stored on another process.
         int faceCell(int face, int local_index) const
         {
-            // In the parallel case we store non-existent cells for faces along
-            // the front region. Theses marked with index std::numeric_limits<int>::max(),
-            // orientation might be arbitrary, though.
-            cpgrid::OrientedEntityTable<1,0>::row_type r
-                = current_view_data_->face_to_cell_[cpgrid::EntityRep<1>(face, true)];
-            bool a = (local_index == 0);
-            bool b = r[0].orientation();
-            bool use_first = a ? b : !b;
-            // The number of valid cells.
-            int r_size = r.size();
-            // In the case of only one valid cell, this is the index of it.
-            int index = 0;
-            if(r[0].index()==std::numeric_limits<int>::max()){
-                assert(r_size==2);
-                --r_size;
-                index=1;
-            }
-            if(r.size()>1 && r[1].index()==std::numeric_limits<int>::max())
-            {
-                assert(r_size==2);
-                --r_size;
-            }
-            if (r_size == 2) {
-                return use_first ? r[0].index() : r[1].index();
-            } else {
-                return use_first ? r[index].index() : -1;
-            }
+            assert(local_index == 0 || local_index == 1);
+            return current_view_data_->face_cells_[2*face + local_index];
+        }
+        /// \brief Get the cells attached to all faces as a flat array.
+        ///
+        /// The cells attached to face f are stored at positions 2*f and 2*f+1,
+        /// with the same meaning and the same -1 markers as returned by faceCell().
+        /// This mirrors UnstructuredGrid::face_cells.
+        /// \return Pointer to the first entry of the array of size 2*numFaces().
+        const int* faceCells() const
+        {
+            return current_view_data_->face_cells_.data();
         }
         /// \brief Get the sum of all faces attached to all cells.
         ///
@@ -1148,6 +1310,8 @@ namespace Dune
         ///
         /// This method does not do communication but assumes that the global grid
         /// is present on every process and simply copies data to the distributed view.
+        /// \throw std::logic_error if the grid was read once per node or
+        ///        restored from a checkpoint.
         /// \tparam DataHandle The type of the data handle describing the data and responsible for
         ///         gathering and scattering the data.
         /// \param handle The data handle describing the data and responsible for
@@ -1158,6 +1322,9 @@ namespace Dune
 #if HAVE_MPI
             if(!distributed_data_)
                 OPM_THROW(std::runtime_error, "Moving Data only allowed with a load balanced grid!");
+            if(incomplete_global_view_)
+                OPM_THROW(std::logic_error, "The global grid is not present on every process, "
+                          "use scatterCellProperty() instead.");
             distributed_data_->scatterData(handle, data_.get(), distributed_data_.get());
 #else
             // Suppress warnings for unused argument.
@@ -1167,6 +1334,8 @@ namespace Dune
 
         ///
         /// \brief Moves data from the distributed view to the global (all data on process) view.
+        /// \throw std::logic_error if the grid was read once per node or
+        ///        restored from a checkpoint.
         /// \tparam DataHandle The type of the data handle describing the data and responsible for
         ///         gathering and scattering the data.
         /// \param handle The data handle describing the data and responsible for
@@ -1177,10 +1346,95 @@ namespace Dune
 #if HAVE_MPI
             if(!distributed_data_)
                 OPM_THROW(std::runtime_error, "Moving Data only allowed with a load balance grid!");
+            if(incomplete_global_view_)
+                OPM_THROW(std::logic_error, "The global grid is not present on every process, "
+                          "use writeCartesianCellData() instead.");
             distributed_data_->gatherData(handle, data_.get(), distributed_data_.get());
 #else
             // Suppress warnings for unused argument.
             (void) handle;
+#endif
+        }
+
+        /// \brief Scatter a cell property from process 0 without a global array.
+        ///
+        /// Unlike scatterData(), which copies from complete global arrays,
+        /// the producer is called for consecutive chunks of logical Cartesian
+        /// indices, and each chunk is sent straight to the owners of its
+        /// cells along cellScatterGatherInterface(). Hence no process ever
+        /// holds more than one chunk of the property besides its own cells.
+        /// The overlap cells get their values from their owners afterwards.
+        /// Collective. Without a distributed view, all cells are filled
+        /// locally on every process.
+        /// \param producer Called as producer(begin, end, out) to store the
+        ///        values of the logical Cartesian cells [begin, end), including
+        ///        inactive ones, in out. Only called on process 0 once the
+        ///        grid is distributed.
+        /// \param values Resized to and filled with the value of each cell
+        ///        of the current view.
+        /// \param chunk_size The number of logical Cartesian cells per chunk.
+        /// \throw std::logic_error if the grid was restored from a
+        ///        checkpoint, which lacks the scatter interface.
+        template<class T, class Producer>
+        void scatterCellProperty(Producer&& producer, std::vector<T>& values,
+                                 std::size_t chunk_size = 65536)
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                          "The values are sent as raw bytes.");
+            values.resize(numCells());
+            scatterCellChunks([&producer](std::size_t begin, std::size_t end, char* out) {
+                                  producer(begin, end, reinterpret_cast<T*>(out));
+                              },
+                              sizeof(T), reinterpret_cast<char*>(values.data()), chunk_size);
+        }
+
+        /// \brief Write a value per cell to a file in logical Cartesian order.
+        ///
+        /// Unlike gatherData(), the values are not collected on one process.
+        /// Instead num_aggregators processes each collect and write one
+        /// contiguous slice of the logical Cartesian array to the shared
+        /// file with MPI-IO, see cpgrid::writeCartesianArray(). The file holds
+        /// logicalCartesianSize() raw values of type T in native byte order,
+        /// with fill_value for inactive cells. Collective, and works with the
+        /// global as well as with the distributed view. Of the global view,
+        /// which every process holds, only the values of process 0 are used.
+        /// \param data The value of each cell of the current view. Only those
+        ///        of the interior cells are used.
+        /// \param filename The name of the file, which is overwritten.
+        /// \param num_aggregators The number of processes writing to the file.
+        /// \param fill_value The value written for inactive cells.
+        template<class T>
+        void writeCartesianCellData(const std::vector<T>& data, const std::string& filename,
+                                    int num_aggregators = 1, const T& fill_value = T()) const
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                          "The values are written as raw bytes.");
+            if (int(data.size()) != numCells()) {
+                OPM_THROW(std::invalid_argument, "Expected " << numCells() << " values, got "
+                          << data.size());
+            }
+            std::vector<int> cartesian_index;
+            std::vector<T> values;
+            // Each cell has to be written by exactly one process.
+            const bool distributed = distributed_data_ && current_view_data_ == distributed_data_.get();
+            if (distributed || current_view_data_->ccobj_.rank() == 0) {
+                for (auto it = leafbegin<0, Interior_Partition>(); it != leafend<0, Interior_Partition>(); ++it) {
+                    cartesian_index.push_back(globalCell()[it->index()]);
+                    values.push_back(data[it->index()]);
+                }
+            }
+            const auto& dims = logicalCartesianSize();
+            const std::size_t cartesian_size = std::size_t(dims[0]) * dims[1] * dims[2];
+#if HAVE_MPI
+            cpgrid::writeCartesianArray(filename, cartesian_size, cartesian_index,
+                                        reinterpret_cast<const char*>(values.data()), sizeof(T),
+                                        reinterpret_cast<const char*>(&fill_value),
+                                        current_view_data_->ccobj_, num_aggregators);
+#else
+            static_cast<void>(num_aggregators);
+            cpgrid::writeCartesianArray(filename, cartesian_size, cartesian_index,
+                                        reinterpret_cast<const char*>(values.data()), sizeof(T),
+                                        reinterpret_cast<const char*>(&fill_value));
 #endif
         }
 #if HAVE_MPI
@@ -1228,6 +1482,9 @@ namespace Dune
         }
 
         /// \brief Switch to the global view.
+        ///
+        /// If the grid was read once per node, the global view is empty
+        /// except on process 0.
         void switchToGlobalView()
         {
             current_view_data_=data_.get();
@@ -1277,11 +1534,40 @@ namespace Dune
         ///            of each well are stored on one process. This done by
         ///            adding an edge with a very high edge weight for all
         ///            possible pairs of cells in the completion set of a well.
+        /// \param nncs Non-neighbour connections with logical Cartesian cell
+        ///             indices, or null.
         std::pair<bool, std::unordered_set<std::string> >
         scatterGrid(const std::vector<const cpgrid::OpmWellType *> * wells,
                     const double* transmissibilities,
+                    const std::vector<cpgrid::NonNeighbourConnection>* nncs,
                     int overlapLayers);
 
+        /// \brief Implements scatterCellProperty() on raw values.
+        /// \param producer Stores the values of a chunk of logical Cartesian cells.
+        /// \param value_size The size of a value in bytes.
+        /// \param values The values of the cells of the current view.
+        /// \param chunk_size The number of logical Cartesian cells per chunk.
+        void scatterCellChunks(const std::function<void(std::size_t, std::size_t, char*)>& producer,
+                               std::size_t value_size, char* values, std::size_t chunk_size);
+
+        /// \brief Compute partition_quality_ after the distributed view was set up.
+        /// \param cell_part The owner of each cell of the global grid.
+        /// \param transmissibilities The transmissibilities of the faces of
+        ///        the global grid, or null.
+        /// \param nncs The non-neighbour connections with compressed cell indices.
+        /// \param moved_cells The number of cells moved to keep wells whole.
+        void computePartitionQuality(const std::vector<int>& cell_part,
+                                     const double* transmissibilities,
+                                     const std::vector<cpgrid::NonNeighbourConnection>& nncs,
+                                     std::size_t moved_cells);
+
+#if HAVE_MPI
+        /// \brief Get the nodes of the processes of MPI_COMM_WORLD.
+        ///
+        /// Discovered on the first call, which is collective.
+        const cpgrid::NodeTopology& nodeTopology();
+#endif
+
         /** @brief The data stored in the grid.
          *
          * All the data of the grid is stored there and
@@ -1297,6 +1583,26 @@ namespace Dune
          * @warning Will only update owner cells
          */
         std::shared_ptr<InterfaceMap> cell_scatter_gather_interfaces_;
+        /** @brief The quality of the partition of the last loadBalance(). */
+        cpgrid::PartitionQualityReport partition_quality_;
+        /** @brief The file to read the partition from or write it to. */
+        std::string partition_file_;
+        /** @brief Whether to partition among the nodes first. */
+        bool node_aware_partitioning_ = false;
+        /** @brief The nodes of the processes, empty until nodeTopology() is called. */
+        cpgrid::NodeTopology node_topology_;
+        /**
+         * @brief The global grid stored once per node until loadBalance().
+         *
+         * Only set if the grid was read from a cpgrid::NodeSharedGrdecl.
+         */
+        std::shared_ptr<cpgrid::NodeSharedGlobalGrid> node_shared_grid_;
+        /**
+         * @brief Whether the global view is missing on some processes.
+         *
+         * True if the grid was read once per node or restored from a checkpoint.
+         */
+        bool incomplete_global_view_ = false;
     }; // end Class CpGrid
 
 
@@ -21,6 +21,8 @@
 
 #include <opm/grid/GridHelpers.hpp>
 #include <opm/grid/GridManager.hpp>
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgrid/UnstructuredGridView.hpp>
 #include <opm/grid/UnstructuredGrid.h>
 #include <opm/grid/cart_grid.h>
 #include <opm/grid/cornerpoint_grid.h>
@@ -108,6 +110,13 @@ namespace Opm
         }
     }
 
+    /// Construct a view of a CpGrid.
+    GridManager::GridManager(const Dune::CpGrid& grid)
+        : ug_(0),
+          view_(new Dune::cpgrid::UnstructuredGridView(grid))
+    {
+    }
+
     /// Destructor.
     GridManager::~GridManager()
     {
@@ -122,7 +131,7 @@ namespace Opm
     /// to make it clear that we are returning a C-compatible struct.
     const UnstructuredGrid* GridManager::c_grid() const
     {
-        return ug_;
+        return view_ ? &view_->grid() : ug_;
     }
 
 
@@ -22,11 +22,21 @@
 
 #include <opm/grid/utility/OpmParserIncludes.hpp>
 
+#include <memory>
 #include <string>
 
 struct UnstructuredGrid;
 struct grdecl;
 
+namespace Dune
+{
+    class CpGrid;
+    namespace cpgrid
+    {
+        class UnstructuredGridView;
+    }
+}
+
 namespace Opm
 {
     /// This class manages an Opm::UnstructuredGrid in the sense that it
@@ -36,6 +46,7 @@ namespace Opm
     ///   - 3d tensor grids (from deck input)
     ///   - 2d cartesian grids
     ///   - 3d cartesian grids
+    ///   - views of existing CpGrids
     /// The resulting UnstructuredGrid is available through the c_grid() method.
     class GridManager
     {
@@ -72,6 +83,13 @@ namespace Opm
         /// and is therefore only suited for internal use.
         explicit GridManager(const std::string& input_filename);
 
+        /// Construct a view of the current view of a CpGrid, without
+        /// processing the corner-point input again. The arrays are shared
+        /// with the CpGrid where possible, see
+        /// Dune::cpgrid::UnstructuredGridView. Therefore, the CpGrid must
+        /// outlive this object and its current view must not change.
+        explicit GridManager(const Dune::CpGrid& grid);
+
         /// Destructor.
         ~GridManager();
 
@@ -97,6 +115,9 @@ namespace Opm
 
         // The managed UnstructuredGrid.
         UnstructuredGrid* ug_;
+
+        // The view of a CpGrid, used instead of ug_ if present.
+        std::unique_ptr<Dune::cpgrid::UnstructuredGridView> view_;
     };
 
 } // namespace Opm
@@ -19,6 +19,7 @@
 
 #include "config.h"
 #include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/grid_file.h>
 
 #include <assert.h>
 #include <errno.h>
@@ -560,3 +561,300 @@ read_grid(const char *fname)
 }
 
 
+
+
+/* Sections of an UnstructuredGrid in a grid file, see grid_file.h. */
+#define GRID_FILE_KIND "ugrid"
+#define GRID_FILE_NMETA 7
+
+int
+write_grid_binary(const struct UnstructuredGrid *G, const char *fname)
+{
+    struct grid_file_section sections[14];
+    size_t                   n, nd, nc, nf;
+    int                      meta[GRID_FILE_NMETA];
+
+    nd = G->dimensions;
+    nc = G->number_of_cells;
+    nf = G->number_of_faces;
+
+    meta[0] = G->dimensions;
+    meta[1] = G->number_of_cells;
+    meta[2] = G->number_of_faces;
+    meta[3] = G->number_of_nodes;
+    meta[4] = G->cartdims[0];
+    meta[5] = G->cartdims[1];
+    meta[6] = G->cartdims[2];
+
+    n = 0;
+#define ADD_SECTION(nm, tp, cnt, ptr) \
+    do { sections[n].name = (nm); sections[n].type = (tp); \
+         sections[n].count = (cnt); sections[n].data = (ptr); ++n; } while (0)
+
+    ADD_SECTION("meta"          , GRID_FILE_INT32  , GRID_FILE_NMETA           , meta);
+    ADD_SECTION("node_coords"   , GRID_FILE_FLOAT64, nd * G->number_of_nodes   , G->node_coordinates);
+    ADD_SECTION("face_nodepos"  , GRID_FILE_INT32  , nf + 1                    , G->face_nodepos);
+    ADD_SECTION("face_nodes"    , GRID_FILE_INT32  , G->face_nodepos[nf]       , G->face_nodes);
+    ADD_SECTION("face_cells"    , GRID_FILE_INT32  , 2 * nf                    , G->face_cells);
+    ADD_SECTION("face_centroids", GRID_FILE_FLOAT64, nd * nf                   , G->face_centroids);
+    ADD_SECTION("face_areas"    , GRID_FILE_FLOAT64, nf                        , G->face_areas);
+    ADD_SECTION("face_normals"  , GRID_FILE_FLOAT64, nd * nf                   , G->face_normals);
+    ADD_SECTION("cell_facepos"  , GRID_FILE_INT32  , nc + 1                    , G->cell_facepos);
+    ADD_SECTION("cell_faces"    , GRID_FILE_INT32  , G->cell_facepos[nc]       , G->cell_faces);
+    ADD_SECTION("cell_centroids", GRID_FILE_FLOAT64, nd * nc                   , G->cell_centroids);
+    ADD_SECTION("cell_volumes"  , GRID_FILE_FLOAT64, nc                        , G->cell_volumes);
+    if (G->cell_facetag != NULL) {
+        ADD_SECTION("cell_facetag", GRID_FILE_INT32, G->cell_facepos[nc]       , G->cell_facetag);
+    }
+    if (G->global_cell != NULL) {
+        ADD_SECTION("global_cell" , GRID_FILE_INT32, nc                        , G->global_cell);
+    }
+#undef ADD_SECTION
+
+    return write_grid_file(fname, GRID_FILE_KIND, sections, n);
+}
+
+
+/* Copy a section of the expected size into dst. */
+static int
+copy_section(const struct grid_file *f, const char *name,
+             enum grid_file_type type, size_t count, void *dst)
+{
+    const void *src;
+    size_t      n;
+
+    src = grid_file_section(f, name, type, &n);
+
+    if ((src == NULL) || (n != count)) {
+        return 0;
+    }
+
+    memcpy(dst, src, count * (type == GRID_FILE_INT32 ? sizeof(int) : sizeof(double)));
+
+    return 1;
+}
+
+
+struct UnstructuredGrid *
+read_grid_binary(const char *fname)
+{
+    struct UnstructuredGrid *G;
+    struct grid_file        *f;
+    const int               *meta, *pos;
+    size_t                   n, nd, nc, nf, nfn, ncf;
+    int                      ok;
+
+    f = open_grid_file(fname, GRID_FILE_KIND);
+    if (f == NULL) {
+        return NULL;
+    }
+
+    G = NULL;
+
+    meta = grid_file_section(f, "meta", GRID_FILE_INT32, &n);
+    ok   = (meta != NULL) && (n == GRID_FILE_NMETA);
+
+    if (ok) {
+        nd = meta[0];
+        nc = meta[1];
+        nf = meta[2];
+
+        /* The sizes of the connectivity arrays are their last offsets. */
+        pos = grid_file_section(f, "face_nodepos", GRID_FILE_INT32, &n);
+        ok  = (pos != NULL) && (n == nf + 1);
+        nfn = ok ? (size_t) pos[nf] : 0;
+
+        if (ok) {
+            pos = grid_file_section(f, "cell_facepos", GRID_FILE_INT32, &n);
+            ok  = (pos != NULL) && (n == nc + 1);
+            ncf = ok ? (size_t) pos[nc] : 0;
+        }
+
+        if (ok) {
+            G  = allocate_grid(nd, nc, nf, nfn, ncf, meta[3]);
+            ok = G != NULL;
+        }
+    }
+
+    if (ok) {
+        G->cartdims[0] = meta[4];
+        G->cartdims[1] = meta[5];
+        G->cartdims[2] = meta[6];
+
+        ok = copy_section(f, "node_coords"   , GRID_FILE_FLOAT64, nd * G->number_of_nodes, G->node_coordinates) &&
+             copy_section(f, "face_nodepos"  , GRID_FILE_INT32  , nf + 1 , G->face_nodepos)   &&
+             copy_section(f, "face_nodes"    , GRID_FILE_INT32  , nfn    , G->face_nodes)     &&
+             copy_section(f, "face_cells"    , GRID_FILE_INT32  , 2 * nf , G->face_cells)     &&
+             copy_section(f, "face_centroids", GRID_FILE_FLOAT64, nd * nf, G->face_centroids) &&
+             copy_section(f, "face_areas"    , GRID_FILE_FLOAT64, nf     , G->face_areas)     &&
+             copy_section(f, "face_normals"  , GRID_FILE_FLOAT64, nd * nf, G->face_normals)   &&
+             copy_section(f, "cell_facepos"  , GRID_FILE_INT32  , nc + 1 , G->cell_facepos)   &&
+             copy_section(f, "cell_faces"    , GRID_FILE_INT32  , ncf    , G->cell_faces)     &&
+             copy_section(f, "cell_centroids", GRID_FILE_FLOAT64, nd * nc, G->cell_centroids) &&
+             copy_section(f, "cell_volumes"  , GRID_FILE_FLOAT64, nc     , G->cell_volumes);
+    }
+
+    if (ok) {
+        if (grid_file_has_section(f, "cell_facetag")) {
+            ok = copy_section(f, "cell_facetag", GRID_FILE_INT32, ncf, G->cell_facetag);
+        }
+        else {
+            free(G->cell_facetag);
+            G->cell_facetag = NULL;
+        }
+    }
+
+    if (ok && grid_file_has_section(f, "global_cell")) {
+        G->global_cell = malloc(nc * sizeof *G->global_cell);
+        ok = (G->global_cell != NULL) &&
+             copy_section(f, "global_cell", GRID_FILE_INT32, nc, G->global_cell);
+    }
+
+    if (! ok) {
+        destroy_grid(G);
+        G = NULL;
+    }
+
+    close_grid_file(f);
+
+    return G;
+}
+
+
+/* A grid whose arrays point into a mapped grid file. */
+struct mapped_grid {
+    struct UnstructuredGrid  grid;  /* First, see unmap_grid_binary(). */
+    struct grid_file        *file;
+};
+
+
+/* Whether a section is among names, all sections if names is NULL. */
+static int
+is_requested(const char *name, const char *const *names, size_t num_names)
+{
+    size_t i;
+
+    if (names == NULL) {
+        return 1;
+    }
+
+    for (i = 0; i < num_names; ++i) {
+        if (strcmp(names[i], name) == 0) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+/* Data of a requested section of the expected size, NULL if the section
+ * is not requested.  Clears *ok if it is corrupt or of another size. */
+static void *
+map_section(const struct grid_file *f, const char *name,
+            enum grid_file_type type, size_t count,
+            const char *const *names, size_t num_names, int *ok)
+{
+    const void *data;
+    size_t      n;
+
+    data = NULL;
+
+    if (*ok && is_requested(name, names, num_names)) {
+        data = grid_file_section(f, name, type, &n);
+        *ok  = (data != NULL) && (n == count);
+    }
+
+    /* The mapping is read-only, see map_grid_binary(). */
+    return *ok ? (void *) data : NULL;
+}
+
+
+struct UnstructuredGrid *
+map_grid_binary(const char *fname, const char *const *names, size_t num_names)
+{
+    struct mapped_grid      *m;
+    struct UnstructuredGrid *G;
+    struct grid_file        *f;
+    const int               *meta;
+    size_t                   n, nd, nc, nf, nfn, ncf;
+    int                      ok;
+
+    f = open_grid_file(fname, GRID_FILE_KIND);
+    if (f == NULL) {
+        return NULL;
+    }
+
+    m  = calloc(1, sizeof *m);
+    ok = m != NULL;
+
+    if (ok) {
+        m->file = f;
+        G       = &m->grid;
+
+        meta = grid_file_section(f, "meta", GRID_FILE_INT32, &n);
+        ok   = (meta != NULL) && (n == GRID_FILE_NMETA);
+    }
+
+    if (ok) {
+        nd = meta[0];
+        nc = meta[1];
+        nf = meta[2];
+
+        G->dimensions      = meta[0];
+        G->number_of_cells = meta[1];
+        G->number_of_faces = meta[2];
+        G->number_of_nodes = meta[3];
+        G->cartdims[0]     = meta[4];
+        G->cartdims[1]     = meta[5];
+        G->cartdims[2]     = meta[6];
+
+        /* The sizes of the connectivity arrays are their last offsets. */
+        G->face_nodepos = map_section(f, "face_nodepos", GRID_FILE_INT32, nf + 1, NULL, 0, &ok);
+        G->cell_facepos = map_section(f, "cell_facepos", GRID_FILE_INT32, nc + 1, NULL, 0, &ok);
+    }
+
+    if (ok) {
+        nfn = G->face_nodepos[nf];
+        ncf = G->cell_facepos[nc];
+
+        G->node_coordinates = map_section(f, "node_coords"   , GRID_FILE_FLOAT64, nd * G->number_of_nodes, names, num_names, &ok);
+        G->face_nodes       = map_section(f, "face_nodes"    , GRID_FILE_INT32  , nfn    , names, num_names, &ok);
+        G->face_cells       = map_section(f, "face_cells"    , GRID_FILE_INT32  , 2 * nf , names, num_names, &ok);
+        G->face_centroids   = map_section(f, "face_centroids", GRID_FILE_FLOAT64, nd * nf, names, num_names, &ok);
+        G->face_areas       = map_section(f, "face_areas"    , GRID_FILE_FLOAT64, nf     , names, num_names, &ok);
+        G->face_normals     = map_section(f, "face_normals"  , GRID_FILE_FLOAT64, nd * nf, names, num_names, &ok);
+        G->cell_faces       = map_section(f, "cell_faces"    , GRID_FILE_INT32  , ncf    , names, num_names, &ok);
+        G->cell_centroids   = map_section(f, "cell_centroids", GRID_FILE_FLOAT64, nd * nc, names, num_names, &ok);
+        G->cell_volumes     = map_section(f, "cell_volumes"  , GRID_FILE_FLOAT64, nc     , names, num_names, &ok);
+
+        if (grid_file_has_section(f, "cell_facetag")) {
+            G->cell_facetag = map_section(f, "cell_facetag", GRID_FILE_INT32, ncf, names, num_names, &ok);
+        }
+        if (grid_file_has_section(f, "global_cell")) {
+            G->global_cell  = map_section(f, "global_cell" , GRID_FILE_INT32, nc , names, num_names, &ok);
+        }
+    }
+
+    if (! ok) {
+        free(m);
+        close_grid_file(f);
+
+        return NULL;
+    }
+
+    return G;
+}
+
+
+void
+unmap_grid_binary(struct UnstructuredGrid *G)
+{
+    struct mapped_grid *m = (struct mapped_grid *) G;
+
+    if (m != NULL) {
+        close_grid_file(m->file);
+    }
+
+    free(m);
+}
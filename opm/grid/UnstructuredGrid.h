@@ -320,6 +320,65 @@ struct UnstructuredGrid *
 read_grid(const char *fname);
 
 
+/**
+ * Export a grid to a binary grid file, see grid_file.h.
+ *
+ * Unlike the character representation read by read_grid() the values are
+ * stored without loss of precision.
+ *
+ * @param[in] G     Grid.
+ * @param[in] fname File name.
+ * @return Non-zero on success, zero on failure.
+ */
+int
+write_grid_binary(const struct UnstructuredGrid *G, const char *fname);
+
+
+/**
+ * Import a grid from a binary grid file written by write_grid_binary().
+ *
+ * @param[in] fname File name.
+ * @return Fully formed UnstructuredGrid with all fields allocated and filled.
+ * Returns @c NULL if the file cannot be read, is corrupt or in case of
+ * allocation failure.
+ */
+struct UnstructuredGrid *
+read_grid_binary(const char *fname);
+
+
+/**
+ * Map a binary grid file written by write_grid_binary() without copying.
+ *
+ * The arrays of the returned grid point directly into a read-only memory
+ * mapping of the file, so only the pages of the sections used are read.
+ * Sections not listed in @c names are left @c NULL, except
+ * @c face_nodepos and @c cell_facepos which give the sizes of the other
+ * arrays and are always mapped.  The optional sections @c cell_facetag
+ * and @c global_cell are @c NULL if the file does not have them.
+ *
+ * @param[in] fname     File name.
+ * @param[in] names     Names of the sections to map, as used by
+ *                      write_grid_binary(), e.g. "face_cells".  @c NULL
+ *                      maps all sections.
+ * @param[in] num_names Number of entries of @c names.
+ * @return Grid whose arrays must not be modified, to be released with
+ * unmap_grid_binary() rather than destroy_grid().  Returns @c NULL if the
+ * file cannot be read, a requested section is corrupt or in case of
+ * allocation failure.
+ */
+struct UnstructuredGrid *
+map_grid_binary(const char *fname, const char *const *names, size_t num_names);
+
+
+/**
+ * Release a grid returned by map_grid_binary() and unmap its file.
+ *
+ * @param[in,out] G Grid.  May be @c NULL.
+ */
+void
+unmap_grid_binary(struct UnstructuredGrid *G);
+
+
 
 
 bool
@@ -0,0 +1,352 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DUNE_CPGRID_ASYNC_CELL_GATHER_HEADER_INCLUDED
+#define DUNE_CPGRID_ASYNC_CELL_GATHER_HEADER_INCLUDED
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/utility/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if HAVE_MPI
+#include <mpi.h>
+#endif
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief Gathers a value per cell on one process without blocking the others.
+///
+/// Unlike CpGrid::gatherData(), gather() returns as soon as the values of
+/// the interior cells are copied into a pooled send buffer and a
+/// non-blocking MPI_Igatherv is posted. On the root process, a dedicated
+/// I/O thread reorders each completed gather into the global cell order
+/// and hands it to the callback, so the simulation can continue while
+/// the previous report step is being written.
+///
+/// All MPI calls are made by the thread calling gather(), progress() and
+/// wait(), hence MPI_THREAD_FUNNELED suffices. Calling progress() now and
+/// then between report steps lets the gathers complete early. The
+/// callbacks run on the I/O thread one at a time, in the order of the
+/// gathers, and must not use MPI unless it supports MPI_THREAD_MULTIPLE.
+///
+/// Usage:
+/// \code
+/// AsyncCellGather<double> gather(grid);
+/// for (...) {
+///     // compute pressure
+///     gather.gather(pressure, [&](const std::vector<double>& global) { write(global); });
+/// }
+/// gather.wait();
+/// \endcode
+/// \tparam T The type of the values, which are sent as raw bytes.
+template <class T>
+class AsyncCellGather
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The values are sent as raw bytes.");
+
+public:
+    /// \brief The type of the callback receiving the global array on the root.
+    typedef std::function<void(const std::vector<T>&)> Callback;
+
+    /// \brief Prepare gathering the cell values of the current view of a grid.
+    ///
+    /// Gathers the global indices of the interior cells on the root once.
+    /// Collective on the communicator of the grid.
+    /// \param grid The grid, whose current view must not change afterwards.
+    /// \param root The rank receiving the global arrays.
+    /// \param max_pending The number of pooled buffers, i.e. the number of
+    ///        gathers that may be in flight before gather() blocks.
+    explicit AsyncCellGather(const CpGrid& grid, int root = 0, int max_pending = 2)
+        : num_cells_(grid.numCells()), root_(root), slots_(std::max(1, max_pending))
+    {
+        std::vector<int> global_index;
+        for (auto it = grid.leafbegin<0, Interior_Partition>();
+             it != grid.leafend<0, Interior_Partition>(); ++it) {
+            local_index_.push_back(it->index());
+            global_index.push_back(grid.globalIdSet().id(*it));
+        }
+#if HAVE_MPI
+        MPI_Comm_dup(grid.comm(), &comm_);
+        MPI_Comm_rank(comm_, &rank_);
+        int size;
+        MPI_Comm_size(comm_, &size);
+        MPI_Type_contiguous(sizeof(T), MPI_BYTE, &value_type_);
+        MPI_Type_commit(&value_type_);
+
+        int count = local_index_.size();
+        counts_.resize(size);
+        MPI_Gather(&count, 1, MPI_INT, counts_.data(), 1, MPI_INT, root_, comm_);
+        displs_.assign(size + 1, 0);
+        std::partial_sum(counts_.begin(), counts_.end(), displs_.begin() + 1);
+        global_index_.resize(displs_[size]);
+        MPI_Gatherv(global_index.data(), count, MPI_INT, global_index_.data(), counts_.data(),
+                    displs_.data(), MPI_INT, root_, comm_);
+#else
+        global_index_ = global_index;
+#endif
+        if (rank_ == root_) {
+            for (auto& slot : slots_) {
+                slot.received.resize(global_index_.size());
+            }
+            thread_ = std::thread([this]() { run(); });
+        }
+    }
+
+    /// \brief Wait for all gathers and callbacks to finish.
+    ~AsyncCellGather()
+    {
+        try {
+            wait();
+        } catch (...) {
+            // Errors of callbacks were not asked for in time.
+        }
+        if (thread_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            condition_.notify_all();
+            thread_.join();
+        }
+#if HAVE_MPI
+        MPI_Type_free(&value_type_);
+        MPI_Comm_free(&comm_);
+#endif
+    }
+
+    AsyncCellGather(const AsyncCellGather&) = delete;
+    AsyncCellGather& operator=(const AsyncCellGather&) = delete;
+
+    /// \brief Start gathering a value per cell.
+    ///
+    /// Returns once the values are copied, so they may be changed right
+    /// away. Blocks only if max_pending gathers are still in flight.
+    /// Collective, and all processes have to gather in the same order.
+    /// \param values The value of each cell of the current view.
+    /// \param callback Called with the global array on the root.
+    /// \throw std::exception on the root if an earlier callback threw.
+    void gather(const std::vector<T>& values, Callback callback)
+    {
+        if (values.size() != num_cells_) {
+            OPM_THROW(std::invalid_argument, "Expected " << num_cells_ << " values, got "
+                      << values.size());
+        }
+        rethrowError();
+        progress();
+        Slot& slot = acquireSlot();
+        slot.send.resize(local_index_.size());
+        for (std::size_t i = 0; i < local_index_.size(); ++i) {
+            slot.send[i] = values[local_index_[i]];
+        }
+        slot.callback = std::move(callback);
+#if HAVE_MPI
+        MPI_Igatherv(slot.send.data(), slot.send.size(), value_type_, slot.received.data(),
+                     counts_.data(), displs_.data(), value_type_, root_, comm_, &slot.request);
+#endif
+        pending_.push_back(&slot);
+    }
+
+    /// \brief Hand the completed gathers to the I/O thread without blocking.
+    void progress()
+    {
+        while (!pending_.empty() && isComplete(*pending_.front(), false)) {
+            handOff(*pending_.front());
+            pending_.pop_front();
+        }
+    }
+
+    /// \brief Wait until all gathers are complete and all callbacks have run.
+    /// \throw std::exception on the root if a callback threw.
+    void wait()
+    {
+        while (!pending_.empty()) {
+            isComplete(*pending_.front(), true);
+            handOff(*pending_.front());
+            pending_.pop_front();
+        }
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return ready_.empty() && !processing_; });
+        }
+        rethrowError();
+    }
+
+private:
+    struct Slot
+    {
+        std::vector<T> send;
+        std::vector<T> received;
+        Callback callback;
+        bool busy = false;
+#if HAVE_MPI
+        MPI_Request request = MPI_REQUEST_NULL;
+#endif
+    };
+
+    bool isComplete(Slot& slot, bool block)
+    {
+#if HAVE_MPI
+        int done = 1;
+        if (block) {
+            MPI_Wait(&slot.request, MPI_STATUS_IGNORE);
+        } else {
+            MPI_Test(&slot.request, &done, MPI_STATUS_IGNORE);
+        }
+        return done;
+#else
+        static_cast<void>(slot);
+        static_cast<void>(block);
+        return true;
+#endif
+    }
+
+    /// Get a free buffer, completing the oldest gather if there is none.
+    Slot& acquireSlot()
+    {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                for (auto& slot : slots_) {
+                    if (!slot.busy) {
+                        slot.busy = true;
+                        return slot;
+                    }
+                }
+                if (pending_.empty()) {
+                    // All buffers are with the I/O thread.
+                    condition_.wait(lock);
+                    continue;
+                }
+            }
+            isComplete(*pending_.front(), true);
+            handOff(*pending_.front());
+            pending_.pop_front();
+        }
+    }
+
+    void handOff(Slot& slot)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (rank_ == root_) {
+                ready_.push_back(&slot);
+            } else {
+                slot.callback = nullptr;
+                slot.busy = false;
+            }
+        }
+        condition_.notify_all();
+    }
+
+    /// The loop of the I/O thread.
+    void run()
+    {
+        std::vector<T> global;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            condition_.wait(lock, [this]() { return stop_ || !ready_.empty(); });
+            if (ready_.empty()) {
+                return;
+            }
+            Slot& slot = *ready_.front();
+            ready_.pop_front();
+            processing_ = true;
+            lock.unlock();
+
+#if HAVE_MPI
+            const std::vector<T>& received = slot.received;
+#else
+            const std::vector<T>& received = slot.send;
+#endif
+            global.resize(received.size());
+            for (std::size_t i = 0; i < received.size(); ++i) {
+                global[global_index_[i]] = received[i];
+            }
+            std::exception_ptr error;
+            try {
+                slot.callback(global);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            if (error && !error_) {
+                error_ = error;
+            }
+            slot.callback = nullptr;
+            slot.busy = false;
+            processing_ = false;
+            condition_.notify_all();
+        }
+    }
+
+    void rethrowError()
+    {
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::swap(error, error_);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::size_t num_cells_;
+    /// The interior cells of this process.
+    std::vector<int> local_index_;
+    /// On the root the global index of each received value.
+    std::vector<int> global_index_;
+    int root_;
+    int rank_ = 0;
+#if HAVE_MPI
+    MPI_Comm comm_;
+    MPI_Datatype value_type_;
+    std::vector<int> counts_;
+    std::vector<int> displs_;
+#endif
+    std::vector<Slot> slots_;
+    /// The posted gathers, oldest first. Only used by the calling thread.
+    std::deque<Slot*> pending_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    /// Completed gathers waiting for the I/O thread.
+    std::deque<Slot*> ready_;
+    bool processing_ = false;
+    bool stop_ = false;
+    std::exception_ptr error_;
+    std::thread thread_;
+};
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif
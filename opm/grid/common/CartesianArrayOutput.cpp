@@ -0,0 +1,166 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <opm/grid/common/CartesianArrayOutput.hpp>
+#include <opm/grid/utility/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+namespace
+{
+    /// Fill a buffer of count values with fill_value.
+    std::vector<char> filledBuffer(std::size_t count, std::size_t value_size,
+                                   const char* fill_value)
+    {
+        std::vector<char> buffer(count * value_size);
+        for (std::size_t i = 0; i < count; ++i) {
+            std::memcpy(buffer.data() + i * value_size, fill_value, value_size);
+        }
+        return buffer;
+    }
+} // anonymous namespace
+
+void writeCartesianArray(const std::string& filename, std::size_t cartesian_size,
+                         const std::vector<int>& cartesian_index,
+                         const char* values, std::size_t value_size,
+                         const char* fill_value)
+{
+    std::vector<char> buffer = filledBuffer(cartesian_size, value_size, fill_value);
+    for (std::size_t i = 0; i < cartesian_index.size(); ++i) {
+        std::memcpy(buffer.data() + cartesian_index[i] * value_size,
+                    values + i * value_size, value_size);
+    }
+    std::ofstream file(filename, std::ios::binary);
+    file.write(buffer.data(), buffer.size());
+    if (!file) {
+        OPM_THROW(std::runtime_error, "Could not write " << filename);
+    }
+}
+
+#if HAVE_MPI
+void writeCartesianArray(const std::string& filename, std::size_t cartesian_size,
+                         const std::vector<int>& cartesian_index,
+                         const char* values, std::size_t value_size,
+                         const char* fill_value,
+                         MPI_Comm comm, int num_aggregators)
+{
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    num_aggregators = std::max(1, std::min(num_aggregators, size));
+
+    // Aggregator a runs on rank a*size/num_aggregators. If the partition
+    // roughly follows the Cartesian ordering, as Zoltan's does, each
+    // aggregator then mostly collects from its neighbouring ranks.
+    auto aggregatorRank = [&](int a) { return int(std::size_t(a) * size / num_aggregators); };
+    int my_aggregator = -1;
+    for (int a = 0; a < num_aggregators; ++a) {
+        if (aggregatorRank(a) == rank) {
+            my_aggregator = a;
+        }
+    }
+
+    // Sort the values by the aggregator of their slice.
+    std::vector<int> send_counts(size, 0);
+    std::vector<int> destination(cartesian_index.size());
+    for (std::size_t i = 0; i < cartesian_index.size(); ++i) {
+        destination[i] = aggregatorRank(cartesianSliceOwner(cartesian_size, num_aggregators,
+                                                            cartesian_index[i]));
+        ++send_counts[destination[i]];
+    }
+    std::vector<int> send_displ(size + 1, 0);
+    std::partial_sum(send_counts.begin(), send_counts.end(), send_displ.begin() + 1);
+    std::vector<int> send_index(cartesian_index.size());
+    std::vector<char> send_values(cartesian_index.size() * value_size);
+    {
+        std::vector<int> pos(send_displ.begin(), send_displ.end() - 1);
+        for (std::size_t i = 0; i < cartesian_index.size(); ++i) {
+            const int p = pos[destination[i]]++;
+            send_index[p] = cartesian_index[i];
+            std::memcpy(send_values.data() + p * value_size, values + i * value_size, value_size);
+        }
+    }
+
+    std::vector<int> recv_counts(size);
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, comm);
+    std::vector<int> recv_displ(size + 1, 0);
+    std::partial_sum(recv_counts.begin(), recv_counts.end(), recv_displ.begin() + 1);
+
+    MPI_Datatype value_type;
+    MPI_Type_contiguous(value_size, MPI_BYTE, &value_type);
+    MPI_Type_commit(&value_type);
+
+    std::vector<int> recv_index(recv_displ[size]);
+    std::vector<char> recv_values(recv_displ[size] * value_size);
+    MPI_Alltoallv(send_index.data(), send_counts.data(), send_displ.data(), MPI_INT,
+                  recv_index.data(), recv_counts.data(), recv_displ.data(), MPI_INT, comm);
+    MPI_Alltoallv(send_values.data(), send_counts.data(), send_displ.data(), value_type,
+                  recv_values.data(), recv_counts.data(), recv_displ.data(), value_type, comm);
+
+    // Assemble the slice. Processes that are not aggregators write nothing,
+    // but take part in the collective write.
+    std::size_t begin = 0, end = 0;
+    if (my_aggregator >= 0) {
+        begin = cartesianSliceBegin(cartesian_size, num_aggregators, my_aggregator);
+        end = cartesianSliceBegin(cartesian_size, num_aggregators, my_aggregator + 1);
+    }
+    std::vector<char> slice = filledBuffer(end - begin, value_size, fill_value);
+    for (std::size_t i = 0; i < recv_index.size(); ++i) {
+        std::memcpy(slice.data() + (recv_index[i] - begin) * value_size,
+                    recv_values.data() + i * value_size, value_size);
+    }
+
+    MPI_File file;
+    int open_failed = MPI_File_open(comm, const_cast<char*>(filename.c_str()),
+                                    MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL,
+                                    &file) != MPI_SUCCESS;
+    // All processes have to give up together, or the others wait in the
+    // collective write. A file opened by only some of them is not closed,
+    // as closing is collective as well.
+    MPI_Allreduce(MPI_IN_PLACE, &open_failed, 1, MPI_INT, MPI_LOR, comm);
+    if (open_failed) {
+        MPI_Type_free(&value_type);
+        OPM_THROW(std::runtime_error, "Could not open " << filename << " for writing.");
+    }
+    // Truncates a longer existing file.
+    int failed = MPI_File_set_size(file, cartesian_size * value_size) != MPI_SUCCESS;
+    MPI_Status status;
+    failed |= MPI_File_write_at_all(file, begin * value_size, slice.data(), end - begin,
+                                    value_type, &status) != MPI_SUCCESS;
+    failed |= MPI_File_close(&file) != MPI_SUCCESS;
+    MPI_Type_free(&value_type);
+    MPI_Allreduce(MPI_IN_PLACE, &failed, 1, MPI_INT, MPI_LOR, comm);
+    if (failed) {
+        OPM_THROW(std::runtime_error, "Could not write " << filename);
+    }
+}
+#endif
+
+} // end namespace cpgrid
+} // end namespace Dune
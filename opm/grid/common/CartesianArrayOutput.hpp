@@ -0,0 +1,94 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DUNE_CPGRID_CARTESIAN_ARRAY_OUTPUT_HEADER_INCLUDED
+#define DUNE_CPGRID_CARTESIAN_ARRAY_OUTPUT_HEADER_INCLUDED
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#if HAVE_MPI
+#include <mpi.h>
+#endif
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief Get the first logical Cartesian index written by an aggregator.
+///
+/// The array of size cartesian_size is split into num_aggregators
+/// contiguous slices of nearly equal size. The slice of aggregator a is
+/// [cartesianSliceBegin(a), cartesianSliceBegin(a+1)).
+inline std::size_t cartesianSliceBegin(std::size_t cartesian_size, int num_aggregators,
+                                       int aggregator)
+{
+    return cartesian_size * aggregator / num_aggregators;
+}
+
+/// \brief Get the aggregator whose slice contains a logical Cartesian index.
+inline int cartesianSliceOwner(std::size_t cartesian_size, int num_aggregators,
+                               std::size_t cartesian_index)
+{
+    return ((cartesian_index + 1) * num_aggregators - 1) / cartesian_size;
+}
+
+/// \brief Write a value per cell of a logical Cartesian grid to a file.
+///
+/// The file holds cartesian_size raw values of value_size bytes in native
+/// byte order, with the value of cartesian_index[i] at position
+/// cartesian_index[i]. Positions without a value, i.e. inactive cells,
+/// get fill_value.
+/// \param filename The name of the file, which is overwritten.
+/// \param cartesian_size The number of cells of the logical Cartesian grid.
+/// \param cartesian_index The logical Cartesian index of each value.
+/// \param values The values, cartesian_index.size() of value_size bytes each.
+/// \param value_size The size of a value in bytes.
+/// \param fill_value The value_size bytes written for cells without a value.
+/// \throw std::runtime_error if the file cannot be written.
+void writeCartesianArray(const std::string& filename, std::size_t cartesian_size,
+                         const std::vector<int>& cartesian_index,
+                         const char* values, std::size_t value_size,
+                         const char* fill_value);
+
+#if HAVE_MPI
+/// \brief Write a value per cell of a distributed logical Cartesian grid
+///        to a shared file without gathering the values on one process.
+///
+/// The file has the same layout as for the sequential version. Each
+/// process passes the values of the cells it owns, and every cell has to
+/// be owned by exactly one process. num_aggregators processes, spread
+/// evenly over the ranks of comm, each collect the values of one
+/// contiguous slice of the array from the other processes and write it
+/// at its offset in the file with MPI-IO, so no process ever holds more
+/// than its slice. Collective on comm.
+/// \param num_aggregators The number of processes writing to the file,
+///        clamped to [1, size of comm].
+/// \throw std::runtime_error on all processes if the file cannot be
+///        written.
+void writeCartesianArray(const std::string& filename, std::size_t cartesian_size,
+                         const std::vector<int>& cartesian_index,
+                         const char* values, std::size_t value_size,
+                         const char* fill_value,
+                         MPI_Comm comm, int num_aggregators);
+#endif
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif
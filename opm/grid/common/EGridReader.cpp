@@ -0,0 +1,287 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <opm/grid/common/EGridReader.hpp>
+#include <opm/grid/utility/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+namespace
+{
+    /// Decode a big-endian 32 bit word.
+    std::uint32_t bigEndian32(const unsigned char* bytes)
+    {
+        return (std::uint32_t(bytes[0]) << 24) | (std::uint32_t(bytes[1]) << 16)
+            | (std::uint32_t(bytes[2]) << 8) | std::uint32_t(bytes[3]);
+    }
+
+    /// Decode a big-endian 64 bit word.
+    std::uint64_t bigEndian64(const unsigned char* bytes)
+    {
+        return (std::uint64_t(bigEndian32(bytes)) << 32) | bigEndian32(bytes + 4);
+    }
+
+    /// Header of an array: keyword, number of elements and element type.
+    struct ArrayHeader
+    {
+        std::string keyword;
+        std::size_t count;
+        std::string type;
+    };
+
+    /// Reads the Fortran records of an unformatted Eclipse file.
+    class RecordStream
+    {
+    public:
+        RecordStream(const std::string& filename)
+            : filename_(filename), file_(filename, std::ios::binary)
+        {
+            if (!file_) {
+                OPM_THROW(std::runtime_error, "Could not open EGRID file " << filename);
+            }
+        }
+
+        /// Read the next array header, false at the end of the file.
+        bool readHeader(ArrayHeader& header)
+        {
+            if (file_.peek() == std::char_traits<char>::eof()) {
+                return false;
+            }
+            readRecord();
+            if (record_.size() != 16) {
+                OPM_THROW(std::runtime_error, filename_ << " is not an unformatted EGRID file.");
+            }
+            const char* chars = reinterpret_cast<const char*>(record_.data());
+            header.keyword = trim(std::string(chars, 8));
+            header.count = bigEndian32(record_.data() + 8);
+            header.type = std::string(chars + 12, 4);
+            return true;
+        }
+
+        /// Convert the records of an array into values, one record at a time.
+        template <class T>
+        void readArray(const ArrayHeader& header, T* values)
+        {
+            const bool is_int = header.type == "INTE" || header.type == "LOGI";
+            const bool is_float = header.type == "REAL";
+            if (!is_int && !is_float && header.type != "DOUB") {
+                OPM_THROW(std::runtime_error, "Cannot convert array " << header.keyword
+                          << " of type " << header.type << " to numbers in " << filename_);
+            }
+            const std::size_t size = is_int || is_float ? 4 : 8;
+            std::size_t read = 0;
+            while (read < header.count) {
+                readRecord();
+                const std::size_t n = record_.size() / size;
+                if (n == 0 || read + n > header.count) {
+                    OPM_THROW(std::runtime_error, "Corrupt array " << header.keyword
+                              << " in " << filename_);
+                }
+                const unsigned char* bytes = record_.data();
+                T* out = values + read;
+                if (is_int) {
+                    for (std::size_t i = 0; i < n; ++i) {
+                        out[i] = static_cast<T>(static_cast<std::int32_t>(bigEndian32(bytes + 4*i)));
+                    }
+                } else if (is_float) {
+                    for (std::size_t i = 0; i < n; ++i) {
+                        const std::uint32_t word = bigEndian32(bytes + 4*i);
+                        float value;
+                        std::memcpy(&value, &word, sizeof(value));
+                        out[i] = static_cast<T>(value);
+                    }
+                } else {
+                    for (std::size_t i = 0; i < n; ++i) {
+                        const std::uint64_t word = bigEndian64(bytes + 8*i);
+                        double value;
+                        std::memcpy(&value, &word, sizeof(value));
+                        out[i] = static_cast<T>(value);
+                    }
+                }
+                read += n;
+            }
+        }
+
+        /// Skip the records of an array without reading them.
+        void skipArray(const ArrayHeader& header)
+        {
+            if (header.count == 0 || header.type == "MESS") {
+                return;
+            }
+            const std::size_t size = elementSize(header.type);
+            std::size_t skipped = 0;
+            while (skipped < header.count) {
+                const std::uint32_t length = readMarker();
+                file_.seekg(length, std::ios::cur);
+                if (readMarker() != length || length == 0) {
+                    OPM_THROW(std::runtime_error, "Corrupt array " << header.keyword
+                              << " in " << filename_);
+                }
+                skipped += length / size;
+            }
+        }
+
+    private:
+        std::uint32_t readMarker()
+        {
+            unsigned char bytes[4];
+            file_.read(reinterpret_cast<char*>(bytes), 4);
+            if (!file_) {
+                OPM_THROW(std::runtime_error, "Unexpected end of EGRID file " << filename_);
+            }
+            return bigEndian32(bytes);
+        }
+
+        /// Read one record into record_, checking the markers around it.
+        void readRecord()
+        {
+            const std::uint32_t length = readMarker();
+            record_.resize(length);
+            file_.read(reinterpret_cast<char*>(record_.data()), length);
+            if (readMarker() != length) {
+                OPM_THROW(std::runtime_error, "Corrupt record in EGRID file " << filename_);
+            }
+        }
+
+        std::size_t elementSize(const std::string& type) const
+        {
+            if (type == "INTE" || type == "REAL" || type == "LOGI") {
+                return 4;
+            }
+            if (type == "DOUB" || type == "CHAR") {
+                return 8;
+            }
+            if (type[0] == 'C' && type[1] == '0') {
+                // C0nn, strings of nn characters.
+                return std::stoi(type.substr(1));
+            }
+            OPM_THROW(std::runtime_error, "Unknown array type " << type << " in " << filename_);
+        }
+
+        static std::string trim(const std::string& s)
+        {
+            return s.substr(0, s.find_last_not_of(' ') + 1);
+        }
+
+        std::string filename_;
+        std::ifstream file_;
+        std::vector<unsigned char> record_;
+    };
+
+    template <class T>
+    void readExpected(RecordStream& stream, const ArrayHeader& header,
+                      std::size_t expected, std::vector<T>& values,
+                      const std::string& filename)
+    {
+        if (header.count != expected) {
+            OPM_THROW(std::runtime_error, header.keyword << " in " << filename << " has "
+                      << header.count << " elements, expected " << expected);
+        }
+        values.resize(expected);
+        stream.readArray(header, values.data());
+    }
+} // anonymous namespace
+
+EGridReader::EGridReader(const std::string& filename)
+    : dims_{{ 0, 0, 0 }}
+{
+    RecordStream stream(filename);
+    ArrayHeader header;
+    bool has_gridhead = false;
+    bool in_main_grid = true;
+    bool main_grid_nncs = false;
+    std::vector<int> nnc1, nnc2;
+
+    while (stream.readHeader(header)) {
+        const std::string& kw = header.keyword;
+        if (kw == "LGR") {
+            in_main_grid = false;
+        } else if (kw == "ENDLGR") {
+            in_main_grid = true;
+        }
+
+        if (!in_main_grid) {
+            stream.skipArray(header);
+        } else if (kw == "GRIDHEAD" && !has_gridhead) {
+            std::vector<int> gridhead(header.count);
+            stream.readArray(header, gridhead.data());
+            if (gridhead.size() < 4 || gridhead[0] != 1) {
+                OPM_THROW(std::runtime_error, filename << " does not hold a corner-point grid.");
+            }
+            std::copy(gridhead.begin() + 1, gridhead.begin() + 4, dims_.begin());
+            has_gridhead = true;
+        } else if ((kw == "COORD" || kw == "ZCORN" || kw == "ACTNUM") && !has_gridhead) {
+            OPM_THROW(std::runtime_error, kw << " precedes GRIDHEAD in " << filename);
+        } else if (kw == "COORD" && coord_.empty()) {
+            readExpected(stream, header, 6 * std::size_t(dims_[0] + 1) * (dims_[1] + 1),
+                         coord_, filename);
+        } else if (kw == "ZCORN" && zcorn_.empty()) {
+            readExpected(stream, header, 8 * std::size_t(dims_[0]) * dims_[1] * dims_[2],
+                         zcorn_, filename);
+        } else if (kw == "ACTNUM" && actnum_.empty()) {
+            readExpected(stream, header, std::size_t(dims_[0]) * dims_[1] * dims_[2],
+                         actnum_, filename);
+        } else if (kw == "MAPAXES" && mapaxes_.empty()) {
+            readExpected(stream, header, 6, mapaxes_, filename);
+        } else if (kw == "NNCHEAD") {
+            // The second item is the number of the grid, zero for the main grid.
+            std::vector<int> nnchead(header.count);
+            stream.readArray(header, nnchead.data());
+            main_grid_nncs = nnchead.size() >= 2 && nnchead[1] == 0;
+        } else if (kw == "NNC1" && main_grid_nncs) {
+            nnc1.resize(header.count);
+            stream.readArray(header, nnc1.data());
+        } else if (kw == "NNC2" && main_grid_nncs) {
+            nnc2.resize(header.count);
+            stream.readArray(header, nnc2.data());
+        } else {
+            stream.skipArray(header);
+        }
+    }
+
+    if (coord_.empty() || zcorn_.empty()) {
+        OPM_THROW(std::runtime_error, filename << " lacks GRIDHEAD, COORD or ZCORN.");
+    }
+    if (nnc1.size() != nnc2.size()) {
+        OPM_THROW(std::runtime_error, "NNC1 and NNC2 of " << filename << " differ in size.");
+    }
+    // The cells are one-based in the file.
+    nncs_.reserve(nnc1.size());
+    for (std::size_t i = 0; i < nnc1.size(); ++i) {
+        nncs_.push_back({ nnc1[i] - 1, nnc2[i] - 1, 0.0 });
+    }
+
+    std::copy(dims_.begin(), dims_.end(), input_.dims);
+    input_.coord = coord_.data();
+    input_.zcorn = zcorn_.data();
+    input_.actnum = actnum_.empty() ? nullptr : actnum_.data();
+    input_.mapaxes = mapaxes_.empty() ? nullptr : mapaxes_.data();
+}
+
+} // end namespace cpgrid
+} // end namespace Dune
@@ -0,0 +1,96 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DUNE_CPGRID_EGRID_READER_HEADER_INCLUDED
+#define DUNE_CPGRID_EGRID_READER_HEADER_INCLUDED
+
+#include <opm/grid/cpgpreprocess/preprocess.h>
+#include <opm/grid/cpgrid/NonNeighbourConnection.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief Reads the corner-point description of the main grid from an
+/// unformatted EGRID file.
+///
+/// The file consists of big-endian Fortran records, and every array is
+/// split into records of at most 1000 elements. Each record of COORD,
+/// ZCORN and ACTNUM is converted directly into the arrays input() points
+/// to, so no deck or Opm::EclipseGrid is built and the peak memory is
+/// that of the arrays plus one record. All other arrays are skipped
+/// without being read, as are local grid refinements.
+///
+/// Usage:
+/// \code
+/// EGridReader reader("CASE.EGRID");
+/// grid.processEclipseFormat(reader.input(), 0.0, false);
+/// \endcode
+class EGridReader
+{
+public:
+    /// \brief Read the main grid of an EGRID file.
+    /// \param filename The name of the file.
+    /// \throw std::runtime_error if the file cannot be read, is not an
+    ///        unformatted EGRID file of a corner-point grid, or lacks
+    ///        GRIDHEAD, COORD or ZCORN.
+    explicit EGridReader(const std::string& filename);
+
+    /// \brief Get the input to CpGrid::processEclipseFormat().
+    ///
+    /// The arrays are owned by the reader, which must therefore
+    /// outlive the processing.
+    const grdecl& input() const
+    {
+        return input_;
+    }
+
+    /// \brief Get the logical Cartesian dimensions of the grid.
+    const std::array<int, 3>& dimensions() const
+    {
+        return dims_;
+    }
+
+    /// \brief Get the non-neighbour connections of the main grid.
+    ///
+    /// The cells are logical Cartesian indices, as expected by
+    /// CpGrid::loadBalance(). EGRID files do not store the
+    /// transmissibilities, which live in TRANNNC of the INIT file,
+    /// so trans is zero.
+    const std::vector<NonNeighbourConnection>& nncs() const
+    {
+        return nncs_;
+    }
+
+private:
+    std::array<int, 3> dims_;
+    std::vector<double> coord_;
+    std::vector<double> zcorn_;
+    std::vector<int> actnum_;
+    std::vector<double> mapaxes_;
+    std::vector<NonNeighbourConnection> nncs_;
+    grdecl input_;
+};
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif
@@ -39,6 +39,7 @@
 #endif
 #include "GridPartitioning.hpp"
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/common/NodeSharedGlobalGrid.hpp>
 #include <stack>
 
 namespace Dune
@@ -182,6 +183,25 @@ namespace Dune
             }
         }
 
+        /// Add the cells on the other side of a non-neighbour connection
+        /// to the overlap, they are needed to compute its flux.
+        void addNncOverlap(const std::vector<cpgrid::NonNeighbourConnection>& nncs,
+                           const std::vector<int>& cell_part,
+                           std::vector<std::set<int> >& cell_overlap,
+                           int mypart, bool all)
+        {
+            for ( const auto& nnc : nncs )
+            {
+                const int part1 = cell_part[nnc.cell1];
+                const int part2 = cell_part[nnc.cell2];
+                if ( part1 != part2 && ( all || part1 == mypart || part2 == mypart ) )
+                {
+                    cell_overlap[nnc.cell1].insert(part2);
+                    cell_overlap[nnc.cell2].insert(part1);
+                }
+            }
+        }
+
     } // anon namespace
 
 
@@ -306,7 +326,8 @@ void addOverlapLayer(const CpGrid& grid, int index, const CpGrid::Codim<0>::Enti
 
     void addOverlapLayer(const CpGrid& grid, const std::vector<int>& cell_part,
                          std::vector<std::set<int> >& cell_overlap, int mypart,
-                         int layers, bool all)
+                         int layers, bool all,
+                         const std::vector<cpgrid::NonNeighbourConnection>* nncs)
     {
         cell_overlap.resize(cell_part.size());
         const CpGrid::LeafIndexSet& ix = grid.leafIndexSet();
@@ -325,6 +346,101 @@ void addOverlapLayer(const CpGrid& grid, int index, const CpGrid::Codim<0>::Enti
             }
             addOverlapLayer(grid, index, *it, owner, cell_part, cell_overlap, layers-1);
         }
+        if ( nncs )
+        {
+            addNncOverlap(*nncs, cell_part, cell_overlap, mypart, all);
+        }
 }
+
+#if HAVE_MPI
+namespace
+{
+/// The cell on the other side of a face of cell, or -1 at the boundary.
+int neighbourAcross(const cpgrid::NodeSharedGlobalGrid& grid, int cell,
+                    const cpgrid::EntityRep<1>& face)
+{
+    const auto cells = grid.faceCells(face.index());
+    if ( cells.size() != 2 )
+    {
+        return -1;
+    }
+    return cells[0].index() == cell ? cells[1].index() : cells[0].index();
+}
+
+void addOverlapCornerCell(const cpgrid::NodeSharedGlobalGrid& grid, int owner,
+                          int from, int neighbor,
+                          const std::vector<int>& cell_part,
+                          std::vector<std::set<int> >& cell_overlap)
+{
+    // Compares the corners with the same local index, like the overload
+    // for CpGrid, so that both give the same overlap.
+    const auto& from_points = grid.cellPoints(from);
+    const auto& neighbor_points = grid.cellPoints(neighbor);
+    for ( int i = 0; i < 8; i++ )
+    {
+        if ( from_points[i] == neighbor_points[i] )
+        {
+            cell_overlap[neighbor].insert(owner);
+            cell_overlap[from].insert(cell_part[neighbor]);
+            return;
+        }
+    }
+}
+
+void addOverlapLayer(const cpgrid::NodeSharedGlobalGrid& grid, int index,
+                     const int owner, const std::vector<int>& cell_part,
+                     std::vector<std::set<int> >& cell_overlap, int recursion_deps)
+{
+    for ( const auto& face : grid.cellFaces(index) )
+    {
+        const int nb_index = neighbourAcross(grid, index, face);
+        if ( nb_index < 0 || cell_part[nb_index] == owner )
+        {
+            continue;
+        }
+        cell_overlap[nb_index].insert(owner);
+        cell_overlap[index].insert(cell_part[nb_index]);
+        if ( recursion_deps > 0 )
+        {
+            // Add another layer
+            addOverlapLayer(grid, nb_index, owner, cell_part, cell_overlap, recursion_deps-1);
+        }
+        else
+        {
+            // Add cells to the overlap that just share a corner with index.
+            for ( const auto& face2 : grid.cellFaces(nb_index) )
+            {
+                const int nb_index2 = neighbourAcross(grid, nb_index, face2);
+                if ( nb_index2 < 0 || cell_part[nb_index2] == owner )
+                {
+                    continue;
+                }
+                addOverlapCornerCell(grid, owner, index, nb_index2, cell_part, cell_overlap);
+            }
+        }
+    }
+}
+} // anonymous namespace
+
+    void addOverlapLayer(const cpgrid::NodeSharedGlobalGrid& grid, const std::vector<int>& cell_part,
+                         std::vector<std::set<int> >& cell_overlap, int mypart,
+                         int layers, bool all,
+                         const std::vector<cpgrid::NonNeighbourConnection>* nncs)
+    {
+        cell_overlap.resize(cell_part.size());
+        for ( int index = 0; index < grid.numCells(); ++index )
+        {
+            if ( cell_part[index] != mypart && !all )
+            {
+                continue;
+            }
+            addOverlapLayer(grid, index, cell_part[index], cell_part, cell_overlap, layers-1);
+        }
+        if ( nncs )
+        {
+            addNncOverlap(*nncs, cell_part, cell_overlap, mypart, all);
+        }
+    }
+#endif // #if HAVE_MPI
 } // namespace Dune
 
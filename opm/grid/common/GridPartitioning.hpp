@@ -41,11 +41,18 @@
 #include <array>
 #include <set>
 
+#include <opm/grid/cpgrid/NonNeighbourConnection.hpp>
+
 namespace Dune
 {
 
     class CpGrid;
 
+    namespace cpgrid
+    {
+        class NodeSharedGlobalGrid;
+    }
+
     struct OrderByFirst
     {
         bool operator()(const std::pair<int,int>& o, const std::pair<int,int>& v)
@@ -77,10 +84,24 @@ namespace Dune
 /// \param[in] mypart The partition number of the processor.
 /// \param[in] all Whether to compute the overlap for all partions or just the
 ///            one associated by mypart.
+/// \param[in] nncs Non-neighbour connections with compressed cell indices, or
+///            null. A cell connected to an owned cell by one of them becomes
+///            an overlap cell, too.
      void addOverlapLayer(const CpGrid& grid,
                           const std::vector<int>& cell_part,
                           std::vector<std::set<int> >& cell_overlap,
-                          int mypart, int overlapLayers, bool all=false);
+                          int mypart, int overlapLayers, bool all=false,
+                          const std::vector<cpgrid::NonNeighbourConnection>* nncs = nullptr);
+
+#if HAVE_MPI
+/// \brief Adds a layer of overlap cells to a partitioning of a global grid
+///        stored once per node, like the overload for CpGrid.
+     void addOverlapLayer(const cpgrid::NodeSharedGlobalGrid& grid,
+                          const std::vector<int>& cell_part,
+                          std::vector<std::set<int> >& cell_overlap,
+                          int mypart, int overlapLayers, bool all=false,
+                          const std::vector<cpgrid::NonNeighbourConnection>* nncs = nullptr);
+#endif
 
 } // namespace Dune
 
@@ -0,0 +1,125 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DUNE_CPGRID_NODE_SHARED_ARRAY_HEADER_INCLUDED
+#define DUNE_CPGRID_NODE_SHARED_ARRAY_HEADER_INCLUDED
+
+#if HAVE_MPI
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief An array stored once per node in an MPI-3 shared memory window.
+///
+/// The first process of the node communicator allocates the memory, all
+/// processes of the node access it directly. By convention only the first
+/// process writes, followed by a call to synchronize().
+/// \tparam T The entry type, has to be trivially copyable.
+template<class T>
+class NodeSharedArray
+{
+public:
+    NodeSharedArray() = default;
+
+    /// \brief Allocate the array. Collective on node_comm.
+    /// \param node_comm A communicator whose processes share memory, e.g.
+    ///        created by MPI_Comm_split_type with MPI_COMM_TYPE_SHARED.
+    /// \param size The number of entries. Only used on rank 0 of node_comm.
+    NodeSharedArray(MPI_Comm node_comm, std::size_t size)
+    {
+        int rank;
+        MPI_Comm_rank(node_comm, &rank);
+        std::uint64_t global_size = size;
+        MPI_Bcast(&global_size, 1, MPI_UINT64_T, 0, node_comm);
+        size_ = global_size;
+
+        void* base = nullptr;
+        const MPI_Aint bytes = rank == 0 ? size_ * sizeof(T) : 0;
+        MPI_Win_allocate_shared(bytes, sizeof(T), MPI_INFO_NULL, node_comm, &base, &win_);
+        MPI_Aint segment_size;
+        int disp_unit;
+        MPI_Win_shared_query(win_, 0, &segment_size, &disp_unit, &base);
+        data_ = static_cast<T*>(base);
+        MPI_Win_fence(0, win_);
+    }
+
+    NodeSharedArray(const NodeSharedArray&) = delete;
+    NodeSharedArray& operator=(const NodeSharedArray&) = delete;
+
+    NodeSharedArray(NodeSharedArray&& other)
+    {
+        swap(other);
+    }
+
+    NodeSharedArray& operator=(NodeSharedArray&& other)
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~NodeSharedArray()
+    {
+        if (win_ != MPI_WIN_NULL) {
+            MPI_Win_free(&win_);
+        }
+    }
+
+    /// \brief Make the writes of the first process visible on the node.
+    ///        Collective on the node communicator.
+    void synchronize()
+    {
+        MPI_Win_fence(0, win_);
+    }
+
+    T* data()
+    {
+        return data_;
+    }
+    const T* data() const
+    {
+        return data_;
+    }
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+private:
+    void swap(NodeSharedArray& other)
+    {
+        std::swap(win_, other.win_);
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+
+    MPI_Win win_ = MPI_WIN_NULL;
+    T* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // HAVE_MPI
+#endif
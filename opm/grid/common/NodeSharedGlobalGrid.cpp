@@ -0,0 +1,168 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#if HAVE_MPI
+
+#include <opm/grid/common/NodeSharedGlobalGrid.hpp>
+#include <opm/grid/cpgrid/CpGridData.hpp>
+
+#include <algorithm>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+namespace
+{
+    /// Allocate an array on the node, which the first process fills.
+    template<class T, class Fill>
+    NodeSharedArray<T> shareArray(MPI_Comm node_comm, bool is_leader,
+                                  std::size_t size, Fill&& fill)
+    {
+        NodeSharedArray<T> array(node_comm, is_leader ? size : 0);
+        if (is_leader) {
+            fill(array.data());
+        }
+        array.synchronize();
+        return array;
+    }
+
+    boost::iterator_range<const int*> rowOf(const Opm::SparseTable<int>& table, int row)
+    {
+        return table[row];
+    }
+
+    template<int codim_from, int codim_to>
+    OrientedEntityRange<codim_to> rowOf(const OrientedEntityTable<codim_from, codim_to>& table,
+                                        int row)
+    {
+        return table[EntityRep<codim_from>(row, true)];
+    }
+
+    /// Copy the rows of a table and store where each of them starts.
+    template<class T, class Table>
+    void shareRows(const Table& table, int num_rows, MPI_Comm node_comm, bool is_leader,
+                   NodeSharedArray<int>& start, NodeSharedArray<T>& data)
+    {
+        start = shareArray<int>(node_comm, is_leader, num_rows + 1, [&](int* out) {
+                out[0] = 0;
+                for (int row = 0; row < num_rows; ++row) {
+                    out[row + 1] = out[row] + rowOf(table, row).size();
+                }
+            });
+        data = shareArray<T>(node_comm, is_leader, table.dataSize(), [&](T* out) {
+                for (int row = 0; row < num_rows; ++row) {
+                    const auto r = rowOf(table, row);
+                    out = std::copy(r.begin(), r.end(), out);
+                }
+            });
+    }
+
+    /// Store the three coordinates of each entry consecutively.
+    template<class Get>
+    NodeSharedArray<double> sharePoints(MPI_Comm node_comm, bool is_leader,
+                                        int size, Get&& get)
+    {
+        return shareArray<double>(node_comm, is_leader, 3 * std::size_t(size), [&](double* out) {
+                for (int i = 0; i < size; ++i) {
+                    const auto p = get(i);
+                    std::copy(p.begin(), p.end(), out + 3*i);
+                }
+            });
+    }
+} // anonymous namespace
+
+NodeSharedGlobalGrid::NodeSharedGlobalGrid(const CpGridData& grid, MPI_Comm node_comm)
+{
+    int node_rank;
+    MPI_Comm_rank(node_comm, &node_rank);
+    const bool is_leader = node_rank == 0;
+
+    const auto& cell_geom = grid.geomVector<0>();
+    const auto& face_geom = grid.geomVector<1>();
+    const auto& point_geom = grid.geomVector<3>();
+    const int num_cells = cell_geom.size();
+    const int num_faces = face_geom.size();
+    const int num_points = point_geom.size();
+
+    header_ = shareArray<int>(node_comm, is_leader, NumHeaderEntries, [&](int* out) {
+            out[NumCells] = num_cells;
+            out[NumFaces] = num_faces;
+            out[NumPoints] = num_points;
+            std::copy(grid.logical_cartesian_size_.begin(), grid.logical_cartesian_size_.end(),
+                      out + LogicalSizeX);
+            out[HasCorners] = num_cells > 0 && !grid.cell_to_point_.empty();
+            for (int c = 0; c < num_cells; ++c) {
+                out[HasCorners] = out[HasCorners] && cell_geom.get(c).hasCorners();
+            }
+            out[HasUniqueBoundaryIds] = !grid.unique_boundary_ids_.empty();
+        });
+
+    shareRows<EntityRep<1> >(grid.cell_to_face_, num_cells, node_comm, is_leader,
+                             cell_face_start_, cell_faces_);
+    shareRows<EntityRep<0> >(grid.face_to_cell_, num_faces, node_comm, is_leader,
+                             face_cell_start_, face_cells_);
+    shareRows<int>(grid.face_to_point_, num_faces, node_comm, is_leader,
+                   face_point_start_, face_points_);
+    cell_points_ = shareArray<std::array<int, 8> >(node_comm, is_leader, grid.cell_to_point_.size(),
+                                                  [&](std::array<int, 8>* out) {
+            std::copy(grid.cell_to_point_.begin(), grid.cell_to_point_.end(), out);
+        });
+
+    cell_centers_ = sharePoints(node_comm, is_leader, num_cells,
+                                [&](int c) { return cell_geom.get(c).center(); });
+    cell_volumes_ = shareArray<double>(node_comm, is_leader, num_cells, [&](double* out) {
+            for (int c = 0; c < num_cells; ++c) {
+                out[c] = cell_geom.get(c).volume();
+            }
+        });
+    face_centers_ = sharePoints(node_comm, is_leader, num_faces,
+                                [&](int f) { return face_geom.get(f).center(); });
+    face_areas_ = shareArray<double>(node_comm, is_leader, num_faces, [&](double* out) {
+            for (int f = 0; f < num_faces; ++f) {
+                out[f] = face_geom.get(f).volume();
+            }
+        });
+    face_tags_ = shareArray<enum face_tag>(node_comm, is_leader, num_faces, [&](enum face_tag* out) {
+            for (int f = 0; f < num_faces; ++f) {
+                out[f] = grid.face_tag_.get(f);
+            }
+        });
+    face_normals_ = sharePoints(node_comm, is_leader, num_faces,
+                                [&](int f) { return grid.face_normals_.get(f); });
+    point_positions_ = sharePoints(node_comm, is_leader, num_points,
+                                   [&](int p) { return point_geom.get(p).center(); });
+
+    global_cell_ = shareArray<int>(node_comm, is_leader, grid.global_cell_.size(), [&](int* out) {
+            std::copy(grid.global_cell_.begin(), grid.global_cell_.end(), out);
+        });
+    unique_boundary_ids_ = shareArray<int>(node_comm, is_leader, grid.unique_boundary_ids_.size(),
+                                           [&](int* out) {
+            for (int f = 0; f < int(grid.unique_boundary_ids_.size()); ++f) {
+                out[f] = grid.unique_boundary_ids_.get(f);
+            }
+        });
+}
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // HAVE_MPI
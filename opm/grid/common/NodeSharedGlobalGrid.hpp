@@ -0,0 +1,198 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DUNE_CPGRID_NODE_SHARED_GLOBAL_GRID_HEADER_INCLUDED
+#define DUNE_CPGRID_NODE_SHARED_GLOBAL_GRID_HEADER_INCLUDED
+
+#if HAVE_MPI
+
+#include <opm/grid/common/NodeSharedArray.hpp>
+#include <opm/grid/cpgrid/EntityRep.hpp>
+#include <opm/grid/cpgpreprocess/preprocess.h>
+
+#include <opm/grid/utility/platform_dependent/disable_warnings.h>
+#include <boost/range/iterator_range.hpp>
+#include <dune/common/fvector.hh>
+#include <opm/grid/utility/platform_dependent/reenable_warnings.h>
+
+#include <array>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+class CpGridData;
+
+/// \brief The topology and geometry of a global grid, stored once per node
+///        in shared memory.
+///
+/// The first process of each node copies its global grid into MPI-3 shared
+/// memory windows, from which all processes of the node read, e.g. in
+/// CpGridData::distributeGlobalGrid(). The arrays hold indices only, hence
+/// the processes may map the windows at different addresses.
+class NodeSharedGlobalGrid
+{
+public:
+    typedef FieldVector<double, 3> PointType;
+
+    /// \brief Copy the global grid to the node. Collective on node_comm.
+    /// \param grid The global grid. Only used on rank 0 of node_comm.
+    /// \param node_comm A communicator whose processes share memory.
+    NodeSharedGlobalGrid(const CpGridData& grid, MPI_Comm node_comm);
+
+    int numCells() const
+    {
+        return header_.data()[NumCells];
+    }
+    int numFaces() const
+    {
+        return header_.data()[NumFaces];
+    }
+    int numPoints() const
+    {
+        return header_.data()[NumPoints];
+    }
+
+    /// \brief The oriented faces of a cell.
+    boost::iterator_range<const EntityRep<1>*> cellFaces(int cell) const
+    {
+        const int* start = cell_face_start_.data();
+        return { cell_faces_.data() + start[cell], cell_faces_.data() + start[cell + 1] };
+    }
+    /// \brief The oriented cells of a face, one at the boundary.
+    boost::iterator_range<const EntityRep<0>*> faceCells(int face) const
+    {
+        const int* start = face_cell_start_.data();
+        return { face_cells_.data() + start[face], face_cells_.data() + start[face + 1] };
+    }
+    /// \brief The points of a face.
+    boost::iterator_range<const int*> facePoints(int face) const
+    {
+        const int* start = face_point_start_.data();
+        return { face_points_.data() + start[face], face_points_.data() + start[face + 1] };
+    }
+    /// \brief The eight corners of a cell.
+    const std::array<int, 8>& cellPoints(int cell) const
+    {
+        return cell_points_.data()[cell];
+    }
+
+    /// \brief The ids of the IdSet of the global grid, which numbers the
+    ///        faces and points after the cells.
+    int cellId(int cell) const
+    {
+        return cell;
+    }
+    int faceId(int face) const
+    {
+        return numCells() + face;
+    }
+    int pointId(int point) const
+    {
+        return numCells() + point;
+    }
+
+    PointType cellCenter(int cell) const
+    {
+        return point(cell_centers_.data(), cell);
+    }
+    double cellVolume(int cell) const
+    {
+        return cell_volumes_.data()[cell];
+    }
+    /// \brief Whether the geometry of the cells provides their corners.
+    bool cellHasCorners(int /* cell */) const
+    {
+        return header_.data()[HasCorners];
+    }
+    PointType faceCenter(int face) const
+    {
+        return point(face_centers_.data(), face);
+    }
+    double faceArea(int face) const
+    {
+        return face_areas_.data()[face];
+    }
+    enum face_tag faceTag(int face) const
+    {
+        return face_tags_.data()[face];
+    }
+    PointType faceNormal(int face) const
+    {
+        return point(face_normals_.data(), face);
+    }
+    PointType pointPosition(int point_index) const
+    {
+        return point(point_positions_.data(), point_index);
+    }
+
+    /// \brief The logical Cartesian index of each cell.
+    const int* globalCell() const
+    {
+        return global_cell_.data();
+    }
+    std::array<int, 3> logicalCartesianSize() const
+    {
+        const int* header = header_.data();
+        return {{ header[LogicalSizeX], header[LogicalSizeX + 1], header[LogicalSizeX + 2] }};
+    }
+    bool hasUniqueBoundaryIds() const
+    {
+        return header_.data()[HasUniqueBoundaryIds];
+    }
+    int uniqueBoundaryId(int face) const
+    {
+        return unique_boundary_ids_.data()[face];
+    }
+
+private:
+    enum HeaderEntry { NumCells, NumFaces, NumPoints, LogicalSizeX = 3,
+                       HasCorners = 6, HasUniqueBoundaryIds, NumHeaderEntries };
+
+    static PointType point(const double* coordinates, int i)
+    {
+        PointType p;
+        for (int d = 0; d < 3; ++d) {
+            p[d] = coordinates[3*i + d];
+        }
+        return p;
+    }
+
+    NodeSharedArray<int> header_;
+    NodeSharedArray<int> cell_face_start_;
+    NodeSharedArray<EntityRep<1> > cell_faces_;
+    NodeSharedArray<int> face_cell_start_;
+    NodeSharedArray<EntityRep<0> > face_cells_;
+    NodeSharedArray<int> face_point_start_;
+    NodeSharedArray<int> face_points_;
+    NodeSharedArray<std::array<int, 8> > cell_points_;
+    NodeSharedArray<double> cell_centers_;
+    NodeSharedArray<double> cell_volumes_;
+    NodeSharedArray<double> face_centers_;
+    NodeSharedArray<double> face_areas_;
+    NodeSharedArray<enum face_tag> face_tags_;
+    NodeSharedArray<double> face_normals_;
+    NodeSharedArray<double> point_positions_;
+    NodeSharedArray<int> global_cell_;
+    NodeSharedArray<int> unique_boundary_ids_;
+};
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // HAVE_MPI
+#endif
@@ -0,0 +1,112 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#if HAVE_MPI
+
+#include <opm/grid/common/NodeSharedGrdecl.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+namespace
+{
+    /// Broadcast an array whose size may exceed the range of int.
+    template<class T>
+    void broadcastArray(T* data, std::size_t size, MPI_Datatype type, MPI_Comm comm)
+    {
+        const std::size_t chunk = std::numeric_limits<int>::max() / 2;
+        for (std::size_t start = 0; start < size; start += chunk) {
+            const int count = std::min(chunk, size - start);
+            MPI_Bcast(data + start, count, type, 0, comm);
+        }
+    }
+
+    template<class T>
+    void copyAndBroadcast(const T* input, NodeSharedArray<T>& shared, MPI_Datatype type,
+                          bool is_root, MPI_Comm leader_comm)
+    {
+        if (is_root) {
+            std::copy(input, input + shared.size(), shared.data());
+        }
+        if (leader_comm != MPI_COMM_NULL) {
+            broadcastArray(shared.data(), shared.size(), type, leader_comm);
+        }
+        shared.synchronize();
+    }
+} // anonymous namespace
+
+NodeSharedGrdecl::NodeSharedGrdecl(const grdecl& input, MPI_Comm comm)
+    : comm_(comm)
+{
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    const bool is_root = rank == 0;
+
+    // Rank 0 has the smallest key and therefore leads its node.
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm);
+    int node_rank;
+    MPI_Comm_rank(node_comm, &node_rank);
+    MPI_Comm leader_comm;
+    MPI_Comm_split(comm, node_rank == 0 ? 0 : MPI_UNDEFINED, rank, &leader_comm);
+
+    int header[5] = { 0, 0, 0, 0, 0 };
+    if (is_root) {
+        std::copy(input.dims, input.dims + 3, header);
+        header[3] = input.actnum != nullptr;
+        header[4] = input.mapaxes != nullptr;
+        if (input.mapaxes) {
+            std::copy(input.mapaxes, input.mapaxes + 6, mapaxes_.begin());
+        }
+    }
+    MPI_Bcast(header, 5, MPI_INT, 0, comm);
+    MPI_Bcast(mapaxes_.data(), 6, MPI_DOUBLE, 0, comm);
+
+    const std::size_t nx = header[0], ny = header[1], nz = header[2];
+    coord_ = NodeSharedArray<double>(node_comm, 6 * (nx + 1) * (ny + 1));
+    zcorn_ = NodeSharedArray<double>(node_comm, 8 * nx * ny * nz);
+    actnum_ = NodeSharedArray<int>(node_comm, header[3] ? nx * ny * nz : 0);
+    copyAndBroadcast(input.coord, coord_, MPI_DOUBLE, is_root, leader_comm);
+    copyAndBroadcast(input.zcorn, zcorn_, MPI_DOUBLE, is_root, leader_comm);
+    if (header[3]) {
+        copyAndBroadcast(input.actnum, actnum_, MPI_INT, is_root, leader_comm);
+    }
+
+    if (leader_comm != MPI_COMM_NULL) {
+        MPI_Comm_free(&leader_comm);
+    }
+    MPI_Comm_free(&node_comm);
+
+    std::copy(header, header + 3, input_.dims);
+    input_.coord = coord_.data();
+    input_.zcorn = zcorn_.data();
+    input_.actnum = header[3] ? actnum_.data() : nullptr;
+    input_.mapaxes = header[4] ? mapaxes_.data() : nullptr;
+}
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // HAVE_MPI
@@ -0,0 +1,71 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DUNE_CPGRID_NODE_SHARED_GRDECL_HEADER_INCLUDED
+#define DUNE_CPGRID_NODE_SHARED_GRDECL_HEADER_INCLUDED
+
+#if HAVE_MPI
+
+#include <opm/grid/common/NodeSharedArray.hpp>
+#include <opm/grid/cpgpreprocess/preprocess.h>
+
+#include <array>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief Corner-point input stored once per node in shared memory.
+///
+/// The input is only needed on rank 0 of the communicator. It is sent
+/// once to the first process of every node and stored in MPI-3 shared
+/// memory windows that all processes of the node read from. Passing it to
+/// CpGrid::processEclipseFormat() builds the global grid once per node.
+class NodeSharedGrdecl
+{
+public:
+    /// \brief Distribute the input to the nodes. Collective on comm.
+    /// \param input The corner-point input, only used on rank 0 of comm.
+    /// \param comm The communicator of all processes that need the input.
+    NodeSharedGrdecl(const grdecl& input, MPI_Comm comm);
+
+    /// \brief Get the input with the arrays in shared memory.
+    const grdecl& input() const
+    {
+        return input_;
+    }
+
+    /// \brief Get the communicator the input was distributed over.
+    MPI_Comm comm() const
+    {
+        return comm_;
+    }
+
+private:
+    MPI_Comm comm_;
+    NodeSharedArray<double> coord_;
+    NodeSharedArray<double> zcorn_;
+    NodeSharedArray<int> actnum_;
+    std::array<double, 6> mapaxes_;
+    grdecl input_;
+};
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // HAVE_MPI
+#endif
@@ -0,0 +1,76 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <opm/grid/common/NodeTopology.hpp>
+
+#include <algorithm>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+NodeTopology makeNodeTopology(const std::vector<int>& node_of_rank)
+{
+    NodeTopology topology;
+    topology.node_of_rank = node_of_rank;
+    topology.rank_on_node.reserve(node_of_rank.size());
+    const int num_nodes = node_of_rank.empty() ? 0
+        : *std::max_element(node_of_rank.begin(), node_of_rank.end()) + 1;
+    topology.ranks_per_node.assign(num_nodes, 0);
+    for (int node : node_of_rank) {
+        topology.rank_on_node.push_back(topology.ranks_per_node[node]++);
+    }
+    return topology;
+}
+
+#if HAVE_MPI
+NodeTopology computeNodeTopology(MPI_Comm comm)
+{
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // Identify each node by the lowest rank on it.
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm);
+    int leader = rank;
+    MPI_Bcast(&leader, 1, MPI_INT, 0, node_comm);
+    MPI_Comm_free(&node_comm);
+
+    std::vector<int> leaders(size);
+    MPI_Allgather(&leader, 1, MPI_INT, leaders.data(), 1, MPI_INT, comm);
+
+    std::vector<int> node_of_leader(size, -1);
+    std::vector<int> node_of_rank(size);
+    int num_nodes = 0;
+    for (int r = 0; r < size; ++r) {
+        int& node = node_of_leader[leaders[r]];
+        if (node < 0) {
+            node = num_nodes++;
+        }
+        node_of_rank[r] = node;
+    }
+    return makeNodeTopology(node_of_rank);
+}
+#endif
+
+} // end namespace cpgrid
+} // end namespace Dune
@@ -0,0 +1,67 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DUNE_CPGRID_NODE_TOPOLOGY_HEADER_INCLUDED
+#define DUNE_CPGRID_NODE_TOPOLOGY_HEADER_INCLUDED
+
+#include <vector>
+
+#if HAVE_MPI
+#include <mpi.h>
+#endif
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief The assignment of the processes of a communicator to nodes.
+///
+/// Processes on the same node share memory and communicate much faster
+/// with each other than with processes on other nodes.
+struct NodeTopology
+{
+    /// \brief The node of each process, numbered consecutively from 0
+    ///        in the order of the lowest rank on each node.
+    std::vector<int> node_of_rank;
+    /// \brief The rank of each process among the processes of its node.
+    std::vector<int> rank_on_node;
+    /// \brief The number of processes on each node.
+    std::vector<int> ranks_per_node;
+
+    /// \brief Get the number of nodes.
+    int numNodes() const
+    {
+        return ranks_per_node.size();
+    }
+};
+
+/// \brief Create the topology from the node of each process.
+/// \param node_of_rank The node of each process, numbered from 0.
+NodeTopology makeNodeTopology(const std::vector<int>& node_of_rank);
+
+#if HAVE_MPI
+/// \brief Discover the nodes of the processes of a communicator.
+///
+/// Uses MPI_Comm_split_type with MPI_COMM_TYPE_SHARED, i.e. processes that
+/// can share memory are on the same node. Collective on comm.
+/// \param comm The communicator.
+NodeTopology computeNodeTopology(MPI_Comm comm);
+#endif
+
+} // end namespace cpgrid
+} // end namespace Dune
+#endif
@@ -0,0 +1,197 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <opm/grid/common/PartitionCache.hpp>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/common/WellConnections.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+namespace
+{
+    const char partition_magic[8] = { 'O', 'P', 'M', 'P', 'A', 'R', 'T', '1' };
+
+    /// 64 bit FNV-1a hash.
+    class Hasher
+    {
+    public:
+        void add(const void* data, std::size_t size)
+        {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i) {
+                hash_ ^= bytes[i];
+                hash_ *= 1099511628211ULL;
+            }
+        }
+        template<class T>
+        void add(const T& value)
+        {
+            add(&value, sizeof(T));
+        }
+        std::uint64_t value() const
+        {
+            return hash_;
+        }
+    private:
+        std::uint64_t hash_ = 14695981039346656037ULL;
+    };
+
+    int bytesPerPart(int num_parts)
+    {
+        return num_parts <= 256 ? 1 : (num_parts <= 65536 ? 2 : 4);
+    }
+} // anonymous namespace
+
+std::uint64_t partitionHash(const CpGrid& grid,
+                            const WellConnections& well_connections,
+                            const std::vector<NonNeighbourConnection>& nncs,
+                            const double* transmissibilities,
+                            int num_procs,
+                            bool node_aware,
+                            const std::vector<int>& node_of_rank)
+{
+    Hasher hasher;
+    hasher.add(num_procs);
+    hasher.add(static_cast<unsigned char>(node_aware));
+    hasher.add(node_of_rank.size());
+    hasher.add(node_of_rank.data(), node_of_rank.size() * sizeof(int));
+    hasher.add(grid.logicalCartesianSize());
+    const int num_cells = grid.numCells();
+    const int num_faces = grid.numFaces();
+    hasher.add(num_cells);
+    hasher.add(num_faces);
+    hasher.add(grid.globalCell().data(), num_cells * sizeof(int));
+    hasher.add(grid.faceCells(), 2 * num_faces * sizeof(int));
+    if (transmissibilities) {
+        hasher.add(transmissibilities, num_faces * sizeof(double));
+    }
+    hasher.add(well_connections.size());
+    for (const auto& well_cells : well_connections) {
+        hasher.add(well_cells.size());
+        for (int cell : well_cells) {
+            hasher.add(cell);
+        }
+    }
+    hasher.add(nncs.size());
+    for (const auto& nnc : nncs) {
+        hasher.add(nnc.cell1);
+        hasher.add(nnc.cell2);
+        if (transmissibilities) {
+            hasher.add(nnc.trans);
+        }
+    }
+    return hasher.value();
+}
+
+bool readPartition(const std::string& filename, std::uint64_t hash,
+                   std::size_t num_cells, std::vector<int>& cell_part,
+                   int& num_parts)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    char magic[8];
+    std::uint64_t file_hash = 0;
+    std::int32_t file_num_parts = 0;
+    std::uint64_t file_num_cells = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&file_hash), sizeof(file_hash));
+    file.read(reinterpret_cast<char*>(&file_num_parts), sizeof(file_num_parts));
+    file.read(reinterpret_cast<char*>(&file_num_cells), sizeof(file_num_cells));
+    if (!file || std::memcmp(magic, partition_magic, sizeof(magic)) != 0
+        || file_hash != hash || file_num_cells != num_cells || file_num_parts <= 0) {
+        return false;
+    }
+
+    const int bytes = bytesPerPart(file_num_parts);
+    std::vector<unsigned char> buffer(num_cells * bytes);
+    file.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+    if (!file) {
+        return false;
+    }
+    cell_part.resize(num_cells);
+    for (std::size_t cell = 0; cell < num_cells; ++cell) {
+        switch (bytes) {
+        case 1:
+            cell_part[cell] = buffer[cell];
+            break;
+        case 2: {
+            std::uint16_t part;
+            std::memcpy(&part, &buffer[2*cell], 2);
+            cell_part[cell] = part;
+            break;
+        }
+        default: {
+            std::int32_t part;
+            std::memcpy(&part, &buffer[4*cell], 4);
+            cell_part[cell] = part;
+        }
+        }
+    }
+    num_parts = file_num_parts;
+    return true;
+}
+
+void writePartition(const std::string& filename, std::uint64_t hash,
+                    const std::vector<int>& cell_part, int num_parts)
+{
+    const int bytes = bytesPerPart(num_parts);
+    std::vector<unsigned char> buffer(cell_part.size() * bytes);
+    for (std::size_t cell = 0; cell < cell_part.size(); ++cell) {
+        switch (bytes) {
+        case 1:
+            buffer[cell] = static_cast<unsigned char>(cell_part[cell]);
+            break;
+        case 2: {
+            const std::uint16_t part = cell_part[cell];
+            std::memcpy(&buffer[2*cell], &part, 2);
+            break;
+        }
+        default: {
+            const std::int32_t part = cell_part[cell];
+            std::memcpy(&buffer[4*cell], &part, 4);
+        }
+        }
+    }
+
+    std::ofstream file(filename, std::ios::binary);
+    const std::int32_t file_num_parts = num_parts;
+    const std::uint64_t num_cells = cell_part.size();
+    file.write(partition_magic, sizeof(partition_magic));
+    file.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+    file.write(reinterpret_cast<const char*>(&file_num_parts), sizeof(file_num_parts));
+    file.write(reinterpret_cast<const char*>(&num_cells), sizeof(num_cells));
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    if (!file) {
+        std::cerr << "Could not write the partition to " << filename << std::endl;
+    }
+}
+
+} // end namespace cpgrid
+} // end namespace Dune
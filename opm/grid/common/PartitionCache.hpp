@@ -0,0 +1,80 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DUNE_CPGRID_PARTITION_CACHE_HEADER_INCLUDED
+#define DUNE_CPGRID_PARTITION_CACHE_HEADER_INCLUDED
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <opm/grid/cpgrid/NonNeighbourConnection.hpp>
+
+namespace Dune
+{
+class CpGrid;
+
+namespace cpgrid
+{
+class WellConnections;
+
+/// \brief Compute a hash of everything the partition of a grid depends on.
+///
+/// Covers the logical Cartesian size, the active cells, the face to cell
+/// connectivity, the cells of each well, the non-neighbour connections,
+/// the transmissibilities, the number of processes, whether the partition
+/// is node aware and the node of each process.
+/// \param grid The global grid to partition.
+/// \param well_connections The cells perforated by each well.
+/// \param nncs The non-neighbour connections with compressed cell indices.
+/// \param transmissibilities The transmissibilities of the faces, or null.
+/// \param num_procs The number of processes to partition for.
+/// \param node_aware Whether the partition is node aware.
+/// \param node_of_rank The node of each process, see NodeTopology.
+std::uint64_t partitionHash(const CpGrid& grid,
+                            const WellConnections& well_connections,
+                            const std::vector<NonNeighbourConnection>& nncs,
+                            const double* transmissibilities,
+                            int num_procs,
+                            bool node_aware,
+                            const std::vector<int>& node_of_rank);
+
+/// \brief Read a partition written by writePartition().
+/// \param filename The name of the file.
+/// \param hash The hash the partition must have been stored with.
+/// \param num_cells The number of cells the partition must have.
+/// \param[out] cell_part The partition number of each cell.
+/// \param[out] num_parts The number of partitions.
+/// \return True if the file exists and matches hash and num_cells.
+bool readPartition(const std::string& filename, std::uint64_t hash,
+                   std::size_t num_cells, std::vector<int>& cell_part,
+                   int& num_parts);
+
+/// \brief Write a partition to a binary file.
+///
+/// Each partition number is stored with the fewest bytes that can hold
+/// num_parts, in the byte order of the machine. Failures to write are
+/// reported on std::cerr but are not errors.
+/// \param filename The name of the file.
+/// \param hash The hash identifying the partitioned problem.
+/// \param cell_part The partition number of each cell.
+/// \param num_parts The number of partitions.
+void writePartition(const std::string& filename, std::uint64_t hash,
+                    const std::vector<int>& cell_part, int num_parts);
+
+} // end namespace cpgrid
+} // end namespace Dune
+#endif
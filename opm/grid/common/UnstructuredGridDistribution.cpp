@@ -0,0 +1,231 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <opm/grid/common/UnstructuredGridDistribution.hpp>
+#include <opm/grid/UnstructuredGrid.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+
+namespace Opm
+{
+
+namespace
+{
+    void bisect(const UnstructuredGrid& grid, std::vector<int>::iterator begin,
+                std::vector<int>::iterator end, int first_part, int num_parts,
+                std::vector<int>& part)
+    {
+        if (num_parts == 1 || end - begin <= 1) {
+            for (auto cell = begin; cell != end; ++cell) {
+                part[*cell] = first_part;
+            }
+            return;
+        }
+        const int dim = grid.dimensions;
+        const double* centroids = grid.cell_centroids;
+
+        // Split along the longest extent of the centroids.
+        int axis = 0;
+        double longest = -1.0;
+        for (int d = 0; d < dim; ++d) {
+            auto less = [centroids, dim, d](int a, int b) {
+                return centroids[a*dim + d] < centroids[b*dim + d];
+            };
+            const auto extremes = std::minmax_element(begin, end, less);
+            const double extent = centroids[*extremes.second*dim + d]
+                - centroids[*extremes.first*dim + d];
+            if (extent > longest) {
+                longest = extent;
+                axis = d;
+            }
+        }
+
+        // Ties are broken by the cell index, so every process gets the same split.
+        const int left_parts = num_parts / 2;
+        const auto middle = begin + (end - begin) * left_parts / num_parts;
+        std::nth_element(begin, middle, end, [centroids, dim, axis](int a, int b) {
+                const double ca = centroids[a*dim + axis];
+                const double cb = centroids[b*dim + axis];
+                return ca < cb || (ca == cb && a < b);
+            });
+        bisect(grid, begin, middle, first_part, left_parts, part);
+        bisect(grid, middle, end, first_part + left_parts, num_parts - left_parts, part);
+    }
+
+    /// The other cell of a face, or -1.
+    int otherCell(const UnstructuredGrid& grid, int face, int cell)
+    {
+        const int c0 = grid.face_cells[2*face];
+        return c0 == cell ? grid.face_cells[2*face + 1] : c0;
+    }
+} // anonymous namespace
+
+std::vector<int> partitionCellsByCoordinates(const UnstructuredGrid& grid, int num_parts)
+{
+    std::vector<int> cells(grid.number_of_cells);
+    for (int c = 0; c < grid.number_of_cells; ++c) {
+        cells[c] = c;
+    }
+    std::vector<int> part(grid.number_of_cells, 0);
+    bisect(grid, cells.begin(), cells.end(), 0, std::max(num_parts, 1), part);
+    return part;
+}
+
+UnstructuredGridDistribution
+distributeUnstructuredGrid(const UnstructuredGrid& grid, const std::vector<int>& part, int rank)
+{
+    UnstructuredGridDistribution dist;
+    std::set<int> overlap;
+    for (int c = 0; c < grid.number_of_cells; ++c) {
+        if (part[c] != rank) {
+            continue;
+        }
+        dist.global_cell_index.push_back(c);
+        for (int hf = grid.cell_facepos[c]; hf < grid.cell_facepos[c + 1]; ++hf) {
+            const int nb = otherCell(grid, grid.cell_faces[hf], c);
+            if (nb >= 0 && part[nb] != rank) {
+                overlap.insert(nb);
+            }
+        }
+    }
+    dist.num_owned = dist.global_cell_index.size();
+    dist.global_cell_index.insert(dist.global_cell_index.end(), overlap.begin(), overlap.end());
+
+    // A cell is held by its owner and by the owners of its neighbours.
+    for (std::size_t local = 0; local < dist.global_cell_index.size(); ++local) {
+        const int c = dist.global_cell_index[local];
+        std::set<int> holders;
+        holders.insert(part[c]);
+        for (int hf = grid.cell_facepos[c]; hf < grid.cell_facepos[c + 1]; ++hf) {
+            const int nb = otherCell(grid, grid.cell_faces[hf], c);
+            if (nb >= 0) {
+                holders.insert(part[nb]);
+            }
+        }
+        holders.erase(rank);
+        for (int q : holders) {
+            dist.all_all[q].push_back(local);
+            if (part[c] == rank) {
+                dist.owner_overlap[q].first.push_back(local);
+            }
+        }
+        if (part[c] != rank) {
+            dist.owner_overlap[part[c]].second.push_back(local);
+        }
+    }
+    // Owned cells precede the overlap cells locally, but not on the others.
+    for (auto& proc_cells : dist.all_all) {
+        std::sort(proc_cells.second.begin(), proc_cells.second.end(), [&dist](int a, int b) {
+                return dist.global_cell_index[a] < dist.global_cell_index[b];
+            });
+    }
+    return dist;
+}
+
+UnstructuredGrid* extractSubGrid(const UnstructuredGrid& grid, const std::vector<int>& cells)
+{
+    const int dim = grid.dimensions;
+    std::vector<int> new_face(grid.number_of_faces, -1), new_node(grid.number_of_nodes, -1);
+    std::vector<int> faces, nodes;
+    std::size_t num_cell_faces = 0, num_face_nodes = 0;
+    for (int c : cells) {
+        for (int hf = grid.cell_facepos[c]; hf < grid.cell_facepos[c + 1]; ++hf) {
+            const int f = grid.cell_faces[hf];
+            ++num_cell_faces;
+            if (new_face[f] >= 0) {
+                continue;
+            }
+            new_face[f] = faces.size();
+            faces.push_back(f);
+            for (int fn = grid.face_nodepos[f]; fn < grid.face_nodepos[f + 1]; ++fn) {
+                const int n = grid.face_nodes[fn];
+                ++num_face_nodes;
+                if (new_node[n] < 0) {
+                    new_node[n] = nodes.size();
+                    nodes.push_back(n);
+                }
+            }
+        }
+    }
+
+    UnstructuredGrid* sub = allocate_grid(dim, cells.size(), faces.size(), num_face_nodes,
+                                          num_cell_faces, nodes.size());
+    if (sub == NULL) {
+        return NULL;
+    }
+    sub->global_cell = static_cast<int*>(malloc(cells.size() * sizeof *sub->global_cell));
+    if (sub->global_cell == NULL) {
+        destroy_grid(sub);
+        return NULL;
+    }
+    std::copy(grid.cartdims, grid.cartdims + 3, sub->cartdims);
+
+    for (std::size_t n = 0; n < nodes.size(); ++n) {
+        std::memcpy(sub->node_coordinates + n*dim, grid.node_coordinates + nodes[n]*dim,
+                    dim * sizeof(double));
+    }
+
+    std::vector<int> new_cell(grid.number_of_cells, -1);
+    for (std::size_t c = 0; c < cells.size(); ++c) {
+        new_cell[cells[c]] = c;
+    }
+    sub->face_nodepos[0] = 0;
+    for (std::size_t f = 0; f < faces.size(); ++f) {
+        const int old = faces[f];
+        int pos = sub->face_nodepos[f];
+        for (int fn = grid.face_nodepos[old]; fn < grid.face_nodepos[old + 1]; ++fn) {
+            sub->face_nodes[pos++] = new_node[grid.face_nodes[fn]];
+        }
+        sub->face_nodepos[f + 1] = pos;
+        for (int side = 0; side < 2; ++side) {
+            const int c = grid.face_cells[2*old + side];
+            sub->face_cells[2*f + side] = c >= 0 ? new_cell[c] : -1;
+        }
+        std::memcpy(sub->face_centroids + f*dim, grid.face_centroids + old*dim, dim * sizeof(double));
+        std::memcpy(sub->face_normals + f*dim, grid.face_normals + old*dim, dim * sizeof(double));
+        sub->face_areas[f] = grid.face_areas[old];
+    }
+
+    if (grid.cell_facetag == NULL) {
+        free(sub->cell_facetag);
+        sub->cell_facetag = NULL;
+    }
+    sub->cell_facepos[0] = 0;
+    for (std::size_t c = 0; c < cells.size(); ++c) {
+        const int old = cells[c];
+        int pos = sub->cell_facepos[c];
+        for (int hf = grid.cell_facepos[old]; hf < grid.cell_facepos[old + 1]; ++hf, ++pos) {
+            sub->cell_faces[pos] = new_face[grid.cell_faces[hf]];
+            if (sub->cell_facetag != NULL) {
+                sub->cell_facetag[pos] = grid.cell_facetag[hf];
+            }
+        }
+        sub->cell_facepos[c + 1] = pos;
+        std::memcpy(sub->cell_centroids + c*dim, grid.cell_centroids + old*dim, dim * sizeof(double));
+        sub->cell_volumes[c] = grid.cell_volumes[old];
+        sub->global_cell[c] = grid.global_cell != NULL ? grid.global_cell[old] : old;
+    }
+    return sub;
+}
+
+} // namespace Opm
@@ -0,0 +1,80 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_UNSTRUCTUREDGRIDDISTRIBUTION_HEADER_INCLUDED
+#define OPM_UNSTRUCTUREDGRIDDISTRIBUTION_HEADER_INCLUDED
+
+#include <map>
+#include <utility>
+#include <vector>
+
+struct UnstructuredGrid;
+
+namespace Opm
+{
+
+/// \brief Partition the cells of a grid by recursive coordinate bisection.
+///
+/// The cells are split along the longest extent of their centroids until
+/// there are num_parts parts of nearly equal size. The result only depends
+/// on the grid, so all processes holding the same grid compute the same
+/// partition without communication.
+/// \return The part of each cell.
+std::vector<int> partitionCellsByCoordinates(const UnstructuredGrid& grid, int num_parts);
+
+/// \brief The part of a grid held by one process.
+struct UnstructuredGridDistribution
+{
+    /// \brief The global cell of each local cell. The owned cells come
+    ///        first, followed by one layer of overlap cells, each in
+    ///        ascending order.
+    std::vector<int> global_cell_index;
+    /// \brief The number of owned cells.
+    int num_owned = 0;
+    /// \brief For each other process the local cells to send to and to
+    ///        receive from it when copying owner values to the overlap.
+    ///
+    /// The first list holds the owned cells that are overlap cells there,
+    /// the second the overlap cells owned there. Both are ordered by
+    /// global cell, so the lists of two processes match pairwise.
+    std::map<int, std::pair<std::vector<int>, std::vector<int> > > owner_overlap;
+    /// \brief For each other process the local cells it holds, too,
+    ///        ordered by global cell.
+    std::map<int, std::vector<int> > all_all;
+};
+
+/// \brief Compute the cells and communication lists of one process.
+/// \param grid The global grid.
+/// \param part The owner of each cell.
+/// \param rank The process.
+UnstructuredGridDistribution
+distributeUnstructuredGrid(const UnstructuredGrid& grid, const std::vector<int>& part, int rank);
+
+/// \brief Create the grid of a subset of the cells of a grid.
+///
+/// The faces and nodes are those of the cells, numbered in the order
+/// they are first met. Faces towards cells outside the subset become
+/// boundary faces. The global_cell of the result holds the global_cell
+/// of the grid if present, and the index of the cell in the grid
+/// otherwise, so it identifies the cells across processes.
+/// \param grid The grid.
+/// \param cells The cells of the result, in order.
+/// \return A grid to be released with destroy_grid(), null if out of memory.
+UnstructuredGrid* extractSubGrid(const UnstructuredGrid& grid, const std::vector<int>& cells);
+
+} // namespace Opm
+
+#endif // OPM_UNSTRUCTUREDGRIDDISTRIBUTION_HEADER_INCLUDED
@@ -71,11 +71,17 @@ std::vector<std::vector<int> >
 postProcessPartitioningForWells(std::vector<int>& parts,
                                 const std::vector<const OpmWellType*>& wells,
                                 const WellConnections& well_connections,
-                                std::size_t no_procs)
+                                std::size_t no_procs,
+                                std::size_t* moved_cells)
 {
     // Contains for each process the indices of the wells assigned to it.
     std::vector<std::vector<int> > well_indices_on_proc(no_procs);
 
+    if ( moved_cells )
+    {
+        *moved_cells = 0;
+    }
+
 #if HAVE_ECL_INPUT
     if( ! well_connections.size() )
     {
@@ -111,13 +117,17 @@ postProcessPartitioningForWells(std::vector<int>& parts,
                                              no_connections_on_proc.end(),
                                              [](const std::pair<int,std::size_t>& p1,
                                                 const std::pair<int,std::size_t>& p2){
-                                                 return ( p1.second > p2.second );
+                                                 return ( p1.second < p2.second );
                                              })->first;
             std::cout << "Manually moving well " << well->name() << " to partition "
                       << new_owner << std::endl;
 
             for ( auto connection_cell : connections )
             {
+                if ( moved_cells && parts[connection_cell] != new_owner )
+                {
+                    ++(*moved_cells);
+                }
                 parts[connection_cell] = new_owner;
             }
 
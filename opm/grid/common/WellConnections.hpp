@@ -117,11 +117,14 @@ private:
 /// \param eclipseState The eclipse information
 /// \param well_connecton The informatio about the perforations of each well.
 /// \param no_procs The number of processes.
+/// \param moved_cells If not null, the number of cells moved to another
+///                    partition is stored there.
 std::vector<std::vector<int> >
 postProcessPartitioningForWells(std::vector<int>& parts,
                                 const std::vector<const OpmWellType*>&  wells,
                                 const WellConnections& well_connections,
-                                std::size_t no_procs);
+                                std::size_t no_procs,
+                                std::size_t* moved_cells = nullptr);
 
 #ifdef HAVE_MPI
 /// \brief Computes that names that of all wells not handled by this process
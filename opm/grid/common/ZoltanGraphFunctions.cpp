@@ -21,7 +21,9 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <algorithm>
 #include <limits>
+#include <numeric>
 
 #include <opm/grid/utility/OpmParserIncludes.hpp>
 
@@ -117,42 +119,54 @@ void getCpGridNumEdgesList(void *cpGridPointer, int sizeGID, int sizeLID,
     *err = ZOLTAN_OK;
 }
 
+int getCpGridWellsNumVertices(void* graphPointer, int* err)
+{
+    const CombinedGridWellGraph& graph =
+        *static_cast<const CombinedGridWellGraph*>(graphPointer);
+    *err = ZOLTAN_OK;
+    return graph.numVertices();
+}
+
+void getCpGridWellsVertexList(void* graphPointer, int numGlobalIdEntries,
+                              int numLocalIdEntries, ZOLTAN_ID_PTR gids,
+                              ZOLTAN_ID_PTR lids, int wgtDim,
+                              float *objWgts, int *err)
+{
+    const CombinedGridWellGraph& graph =
+        *static_cast<const CombinedGridWellGraph*>(graphPointer);
+    if ( numGlobalIdEntries != numLocalIdEntries || numGlobalIdEntries != 1 )
+    {
+        *err = ZOLTAN_FATAL;
+        return;
+    }
+    for ( int vertex = 0; vertex < graph.numVertices(); ++vertex )
+    {
+        gids[vertex] = vertex;
+        lids[vertex] = vertex;
+        if ( wgtDim == 1 )
+        {
+            objWgts[vertex] = graph.vertexWeight(vertex);
+        }
+    }
+    *err = ZOLTAN_OK;
+}
+
 void getCpGridWellsNumEdgesList(void *graphPointer, int sizeGID, int sizeLID,
-                           int numCells,
+                           int numVertices,
                            ZOLTAN_ID_PTR globalID, ZOLTAN_ID_PTR localID,
                            int *numEdges, int *err)
 {
     (void) globalID;
     const CombinedGridWellGraph& graph =
         *static_cast<CombinedGridWellGraph*>(graphPointer);
-    const Dune::CpGrid&  grid = graph.getGrid();
-    if ( sizeGID != 1 || sizeLID != 1 || numCells != grid.numCells() )
+    if ( sizeGID != 1 || sizeLID != 1 || numVertices != graph.numVertices() )
     {
         *err = ZOLTAN_FATAL;
         return;
     }
-    for( int i = 0; i < numCells;  i++ )
+    for( int i = 0; i < numVertices;  i++ )
     {
-        // Initial set of faces is the ones of the well completions
-        auto edges = graph.getWellsGraph()[i];
-        // For the graph there is an edge only if the face has two neighbors.
-        // Therefore we need to check each face
-        int lid   = localID[i];
-        for ( int local_face = 0; local_face < grid.numCellFaces(static_cast<int>(localID[i])); ++local_face )
-        {
-            const int face  = grid.cellFace(lid, local_face);
-            const int face0 = grid.faceCell(face, 0);
-            const int face1 = grid.faceCell(face, 1);
-
-            if ( face0 != -1 && face1 != -1 )
-            {
-                if ( face0 != i )
-                    edges.insert(face0);
-                else
-                    edges.insert(face1);
-            }
-        }
-        numEdges[i] = edges.size();
+        numEdges[i] = graph.numEdges(localID[i]);
     }
     *err = ZOLTAN_OK;
 }
@@ -239,120 +253,178 @@ void getCpGridEdgeList(void *cpGridPointer, int sizeGID, int sizeLID,
 }
 
 void getCpGridWellsEdgeList(void *graphPointer, int sizeGID, int sizeLID,
-                       int numCells, ZOLTAN_ID_PTR globalID, ZOLTAN_ID_PTR localID,
+                       int numVertices, ZOLTAN_ID_PTR globalID, ZOLTAN_ID_PTR localID,
                        int *numEdges,
                        ZOLTAN_ID_PTR nborGID, int *nborProc,
                        int wgtDim, float *ewgts, int *err)
 {
-    (void) wgtDim; (void) globalID; (void) numEdges; (void) ewgts;
+    (void) wgtDim; (void) globalID; (void) numEdges;
     assert(wgtDim==1);
     const CombinedGridWellGraph& graph =
         *static_cast<const CombinedGridWellGraph*>(graphPointer);
-    const Dune::CpGrid&  grid = graph.getGrid();
 
-    if ( sizeGID != 1 || sizeLID != 1 || numCells != grid.numCells() )
+    if ( sizeGID != 1 || sizeLID != 1 || numVertices != graph.numVertices() )
     {
         *err = ZOLTAN_FATAL;
         return;
     }
-#ifndef NDEBUG
-    int oldidx = 0;
-#endif
     int idx = 0;
 
-    for( int cell = 0; cell < numCells;  cell++ )
+    for( int i = 0; i < numVertices;  i++ )
     {
-        const int currentCell = localID[cell];
-
-        // First the strong edges of the well completions.
-        auto wellEdges = graph.getWellsGraph()[currentCell];
-        for( auto edge : wellEdges)
-        {
-            nborGID[idx] = edge;
-            ewgts[idx++] = std::numeric_limits<float>::max();
-        }
-
-        // Now the ones of the grid that are not handled by the well completions
-        for ( int local_face = 0 ; local_face < grid.numCellFaces(static_cast<int>(localID[cell])); ++local_face )
+        const int vertex = localID[i];
+        assert(numEdges[i] == graph.numEdges(vertex));
+        for ( int edge = 0; edge < graph.numEdges(vertex); ++edge )
         {
-            const int face  = grid.cellFace(currentCell, local_face);
-            int otherCell   = grid.faceCell(face, 0);
-            if ( otherCell == currentCell || otherCell == -1 )
-            {
-                otherCell = grid.faceCell(face, 1);
-                if ( otherCell == currentCell || otherCell == -1 )
-                {
-                    // no real face or already handled by well
-                    continue;
-                }
-                else
-                {
-                    if ( wellEdges.find(otherCell) == wellEdges.end() )
-                    {
-                        nborGID[idx] = globalID[otherCell];
-                        ewgts[idx++] = graph.transmissibility(face);
-                    }
-                    continue;
-                }
-            }
-            if ( wellEdges.find(otherCell) == wellEdges.end() )
-            {
-                nborGID[idx] = globalID[otherCell];
-                ewgts[idx++] = graph.transmissibility(face);
-            }
+            nborGID[idx] = graph.edgeTarget(vertex, edge);
+            ewgts[idx++] = graph.edgeWeight(vertex, edge);
         }
-#ifndef NDEBUG
-        assert(idx-oldidx==numEdges[cell]);
-        oldidx = idx;
-#endif
     }
 
-    const int myrank = grid.comm().rank();
+    const int myrank = graph.getGrid().comm().rank();
 
     for ( int i = 0; i < idx; ++i )
     {
         nborProc[i] = myrank;
     }
-#if defined(DEBUG) && false // The index set will not be initialized here!
-    // The above relies heavily on the grid not being distributed already.
-    // Therefore we check here that all cells are owned by us.
-    GlobalLookupIndexSet<Dune::CpGrid::ParallelIndexSet>
-        globalIdxSet(grid.getCellIndexSet(),
-                     grid.numCells());
-    for ( int cell = 0; cell < numCells;  cell++ )
-    {
-        if ( globalIdxSet.pair(cell)->local().attribute() !=
-             Dune::CpGrid::ParallelIndexSet::LocalIndex::Attribute::owner )
-        {
-            *err = ZOLTAN_FATAL;
-        }
-    }
-#endif
+    *err = ZOLTAN_OK;
 }
 
 CombinedGridWellGraph::CombinedGridWellGraph(const CpGrid& grid,
                                              const std::vector<const OpmWellType*> * wells,
                                              const double* transmissibilities,
-                                             bool pretendEmptyGrid)
+                                             bool pretendEmptyGrid,
+                                             const std::vector<NonNeighbourConnection>* nncs)
     : grid_(grid), transmissibilities_(transmissibilities)
 {
     if ( pretendEmptyGrid )
     {
-        // wellsGraph not needed
+        // graph not needed
         return;
     }
-    wellsGraph_.resize(grid.numCells());
-    const auto& cpgdim = grid.logicalCartesianSize();
-    // create compressed lookup from cartesian.
-    std::vector<int> cartesian_to_compressed(cpgdim[0]*cpgdim[1]*cpgdim[2], -1);
+    if ( wells )
+    {
+        const auto& cpgdim = grid.logicalCartesianSize();
+        // create compressed lookup from cartesian.
+        std::vector<int> cartesian_to_compressed(cpgdim[0]*cpgdim[1]*cpgdim[2], -1);
+
+        for( int i=0; i < grid.numCells(); ++i )
+        {
+            cartesian_to_compressed[grid.globalCell()[i]] = i;
+        }
+        well_indices_.init(*wells, cpgdim, cartesian_to_compressed);
+    }
+    contractWells();
+    computeEdges(nncs);
+}
+
+void CombinedGridWellGraph::contractWells()
+{
+    // Union-find over the cells, merging all cells of each well.
+    std::vector<int> root(grid_.numCells());
+    std::iota(root.begin(), root.end(), 0);
+    auto find = [&root](int cell)
+    {
+        while ( root[cell] != cell )
+        {
+            root[cell] = root[root[cell]];
+            cell = root[cell];
+        }
+        return cell;
+    };
+    for ( const auto& well_cells : well_indices_ )
+    {
+        if ( well_cells.empty() )
+        {
+            continue;
+        }
+        const int first = find(*well_cells.begin());
+        for ( int cell : well_cells )
+        {
+            const int other = find(cell);
+            root[other] = first;
+        }
+    }
 
-    for( int i=0; i < grid.numCells(); ++i )
+    // Number the vertices in the order of their representative cells.
+    cell_to_vertex_.assign(grid_.numCells(), -1);
+    for ( int cell = 0; cell < grid_.numCells(); ++cell )
     {
-        cartesian_to_compressed[grid.globalCell()[i]] = i;
+        const int rep = find(cell);
+        if ( cell_to_vertex_[rep] < 0 )
+        {
+            cell_to_vertex_[rep] = vertex_weights_.size();
+            vertex_weights_.push_back(0);
+        }
+        cell_to_vertex_[cell] = cell_to_vertex_[rep];
+        ++vertex_weights_[cell_to_vertex_[cell]];
     }
-    well_indices_.init(*wells, cpgdim, cartesian_to_compressed);
-    std::vector<int>().swap(cartesian_to_compressed); // free memory.
-    addCompletionSetToGraph();
+}
+
+void CombinedGridWellGraph::computeEdges(const std::vector<NonNeighbourConnection>* nncs)
+{
+    // Collect both directions of each face between different vertices,
+    // then merge the duplicates by sorting.
+    struct Edge
+    {
+        int from;
+        int to;
+        double weight;
+    };
+    std::vector<Edge> edges;
+    edges.reserve(2 * grid_.numFaces());
+    for ( int face = 0; face < grid_.numFaces(); ++face )
+    {
+        const int c0 = grid_.faceCell(face, 0);
+        const int c1 = grid_.faceCell(face, 1);
+        if ( c0 == -1 || c1 == -1 )
+        {
+            continue;
+        }
+        const int v0 = cell_to_vertex_[c0];
+        const int v1 = cell_to_vertex_[c1];
+        if ( v0 != v1 )
+        {
+            edges.push_back(Edge{ v0, v1, transmissibility(face) });
+            edges.push_back(Edge{ v1, v0, transmissibility(face) });
+        }
+    }
+    if ( nncs )
+    {
+        for ( const auto& nnc : *nncs )
+        {
+            const int v0 = cell_to_vertex_[nnc.cell1];
+            const int v1 = cell_to_vertex_[nnc.cell2];
+            if ( v0 != v1 )
+            {
+                edges.push_back(Edge{ v0, v1, nncTransmissibility(nnc) });
+                edges.push_back(Edge{ v1, v0, nncTransmissibility(nnc) });
+            }
+        }
+    }
+    std::sort(edges.begin(), edges.end(),
+              [](const Edge& e1, const Edge& e2)
+              {
+                  return e1.from < e2.from || ( e1.from == e2.from && e1.to < e2.to );
+              });
+
+    edge_offsets_.assign(numVertices() + 1, 0);
+    for ( auto edge = edges.begin(); edge != edges.end(); )
+    {
+        double weight = 0.0;
+        auto same = edge;
+        for ( ; same != edges.end() && same->from == edge->from && same->to == edge->to;
+              ++same )
+        {
+            weight += same->weight;
+        }
+        ++edge_offsets_[edge->from + 1];
+        edge_targets_.push_back(edge->to);
+        edge_weights_.push_back(std::min(weight,
+                                         double(std::numeric_limits<float>::max())));
+        edge = same;
+    }
+    std::partial_sum(edge_offsets_.begin(), edge_offsets_.end(), edge_offsets_.begin());
 }
 
 void setCpGridZoltanGraphFunctions(Zoltan_Struct *zz, const Dune::CpGrid& grid,
@@ -390,8 +462,8 @@ void setCpGridZoltanGraphFunctions(Zoltan_Struct *zz,
     else
     {
         CombinedGridWellGraph* graphPointer = const_cast<CombinedGridWellGraph*>(&graph);
-        Zoltan_Set_Num_Obj_Fn(zz, getCpGridNumCells, gridPointer);
-        Zoltan_Set_Obj_List_Fn(zz, getCpGridVertexList, gridPointer);
+        Zoltan_Set_Num_Obj_Fn(zz, getCpGridWellsNumVertices, graphPointer);
+        Zoltan_Set_Obj_List_Fn(zz, getCpGridWellsVertexList, graphPointer);
         Zoltan_Set_Num_Edges_Multi_Fn(zz, getCpGridWellsNumEdgesList, graphPointer);
         Zoltan_Set_Edge_List_Multi_Fn(zz, getCpGridWellsEdgeList, graphPointer);
     }
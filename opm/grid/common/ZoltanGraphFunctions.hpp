@@ -100,6 +100,19 @@ inline int getNullNumCells(void* cpGridPointer, int* err)
     return 0;
 }
 
+/// \brief Get the number of vertices of the graph of the grid and the wells.
+///
+/// All cells perforated by the same well are contracted to one vertex.
+int getCpGridWellsNumVertices(void* graphPointer, int* err);
+
+/// \brief Get the list of vertices of the graph of the grid and the wells.
+///
+/// The weight of a vertex is the number of cells contracted to it.
+void getCpGridWellsVertexList(void* graphPointer, int numGlobalIds,
+                              int numLocalIds, ZOLTAN_ID_PTR gids,
+                              ZOLTAN_ID_PTR lids, int wgtDim,
+                              float *objWgts, int *err);
+
 /// \brief Get the number of edges the graph of the grid and the wells.
 void getCpGridWellsNumEdgesList(void *cpGridWellsPointer, int sizeGID, int sizeLID,
                            int numCells,
@@ -113,26 +126,33 @@ void getCpGridWellsEdgeList(void *cpGridWellsPointer, int sizeGID, int sizeLID,
                        ZOLTAN_ID_PTR nborGID, int *nborProc,
                        int wgt_dim, float *ewgts, int *err);
 
-/// \brief A graph repesenting a grid together with the well completions.
+/// \brief A graph repesenting a grid together with the well completions
+///        and the non-neighbour connections.
 ///
-/// The edges of the graph are formed by the superset of the edges representing
-/// the faces of the grid and the ones that represent the connections within the
-/// wells. If a well has completions
-/// on cell i and cell j, then there is an edge from i to j and j to i in the graph.
-/// Even for shut wells the connections will exist.
+/// All cells perforated by a well are contracted to one vertex whose weight
+/// is the number of these cells. Wells sharing a cell end up in the same
+/// vertex. The other vertices are the remaining cells with weight one. There
+/// is an edge between two vertices if a face connects their cells, weighted
+/// by the sum of the transmissibilities of these faces.
+///
+/// Partitioning this graph with vertex weights keeps each well on one
+/// process while the balance of cells is maintained by the partitioner,
+/// instead of moving the cells of split wells afterwards. Even for shut
+/// wells the contraction happens. Non-neighbour connections add edges
+/// weighted by their transmissibility like faces.
 class CombinedGridWellGraph
 {
 public:
-    typedef std::vector<std::set<int> > GraphType;
-
     /// \brief Create a graph representing a grid together with the wells.
     /// \param grid The grid.
     /// \param eclipseState The eclipse state to extract the well information from.
     /// \param pretendEmptyGrid True if we should pretend the grid and wells are empty.
+    /// \param nncs Non-neighbour connections with compressed cell indices, or null.
     CombinedGridWellGraph(const Dune::CpGrid& grid,
                           const std::vector<const OpmWellType*> * wells,
                           const double* transmissibilities,
-                          bool pretendEmptyGrid);
+                          bool pretendEmptyGrid,
+                          const std::vector<NonNeighbourConnection>* nncs = nullptr);
 
     /// \brief Access the grid.
     const Dune::CpGrid& getGrid() const
@@ -140,45 +160,77 @@ public:
         return grid_;
     }
 
-    const GraphType& getWellsGraph() const
+    double transmissibility(int face_index) const
     {
-        return wellsGraph_;
+        return transmissibilities_ ? (1.0e18*transmissibilities_[face_index]) : 1;
     }
 
-    double transmissibility(int face_index) const
+    /// \brief The edge weight of a non-neighbour connection, scaled like
+    ///        transmissibility().
+    double nncTransmissibility(const NonNeighbourConnection& nnc) const
     {
-        return transmissibilities_ ? (1.0e18*transmissibilities_[face_index]) : 1;
+        return transmissibilities_ ? (1.0e18*nnc.trans) : 1;
     }
 
     const WellConnections& getWellConnections() const
     {
         return well_indices_;
     }
-private:
 
-    void addCompletionSetToGraph()
+    /// \brief The number of vertices of the contracted graph.
+    int numVertices() const
+    {
+        return vertex_weights_.size();
+    }
+
+    /// \brief The vertex a cell is contracted to.
+    int vertexOfCell(int cell) const
     {
-        for(const auto& well_indices: well_indices_)
-        {
-            for( auto well_idx = well_indices.begin(); well_idx != well_indices.end();
-                 ++well_idx)
-            {
-                auto well_idx2 = well_idx;
-                for( ++well_idx2; well_idx2 != well_indices.end();
-                     ++well_idx2)
-                {
-                    wellsGraph_[*well_idx].insert(*well_idx2);
-                    wellsGraph_[*well_idx2].insert(*well_idx);
-                }
-            }
-        }
+        return cell_to_vertex_[cell];
     }
 
+    /// \brief The number of cells contracted to a vertex.
+    int vertexWeight(int vertex) const
+    {
+        return vertex_weights_[vertex];
+    }
+
+    /// \brief The number of edges of a vertex.
+    int numEdges(int vertex) const
+    {
+        return edge_offsets_[vertex + 1] - edge_offsets_[vertex];
+    }
+
+    /// \brief The neighbour of a vertex at an edge.
+    /// \param vertex The vertex.
+    /// \param edge The local index of the edge, less than numEdges(vertex).
+    int edgeTarget(int vertex, int edge) const
+    {
+        return edge_targets_[edge_offsets_[vertex] + edge];
+    }
+
+    /// \brief The weight of an edge of a vertex.
+    float edgeWeight(int vertex, int edge) const
+    {
+        return edge_weights_[edge_offsets_[vertex] + edge];
+    }
+
+private:
+    /// \brief Compute cell_to_vertex_ and vertex_weights_.
+    void contractWells();
+
+    /// \brief Compute the edges between the vertices from the faces and
+    ///        the non-neighbour connections.
+    void computeEdges(const std::vector<NonNeighbourConnection>* nncs);
 
     const Dune::CpGrid& grid_;
-    GraphType wellsGraph_;
     const double* transmissibilities_;
     WellConnections well_indices_;
+    std::vector<int> cell_to_vertex_;
+    std::vector<int> vertex_weights_;
+    std::vector<int> edge_offsets_;
+    std::vector<int> edge_targets_;
+    std::vector<float> edge_weights_;
 };
 
 
@@ -29,12 +29,49 @@ namespace Dune
 {
 namespace cpgrid
 {
-std::pair<std::vector<int>, std::unordered_set<std::string> >
+namespace
+{
+/// \brief The levels of the node aware partitioning for Zoltan's HIER method.
+///
+/// On the first level the graph is partitioned among the nodes and on
+/// the second one among the processes of each node.
+struct HierarchicalLevels
+{
+    const NodeTopology* topology;
+    int rank;
+};
+
+int getHierNumLevels(void*, int* err)
+{
+    *err = ZOLTAN_OK;
+    return 2;
+}
+
+int getHierPart(void* data, int level, int* err)
+{
+    const auto& levels = *static_cast<const HierarchicalLevels*>(data);
+    *err = ZOLTAN_OK;
+    return level == 0 ? levels.topology->node_of_rank[levels.rank]
+        : levels.topology->rank_on_node[levels.rank];
+}
+
+void setHierMethod(void*, int, struct Zoltan_Struct* zz, int* err)
+{
+    Zoltan_Set_Param(zz, "LB_METHOD", "GRAPH");
+    Zoltan_Set_Param(zz, "LB_APPROACH", "PARTITION");
+    Zoltan_Set_Param(zz, "PHG_EDGE_SIZE_THRESHOLD", ".35");
+    *err = ZOLTAN_OK;
+}
+} // anonymous namespace
+
+std::tuple<std::vector<int>, std::unordered_set<std::string>, std::size_t>
 zoltanGraphPartitionGridOnRoot(const CpGrid& cpgrid,
                                const std::vector<const OpmWellType*> * wells,
                                const double* transmissibilities,
                                const CollectiveCommunication<MPI_Comm>& cc,
-                               int root)
+                               int root,
+                               const std::vector<NonNeighbourConnection>* nncs,
+                               const NodeTopology* node_topology)
 {
     int rc = ZOLTAN_OK - 1;
     float ver = 0;
@@ -62,6 +99,18 @@ zoltanGraphPartitionGridOnRoot(const CpGrid& cpgrid,
     Zoltan_Set_Param(zz, "OBJ_WEIGHT_DIM", "0");
     Zoltan_Set_Param(zz, "PHG_EDGE_SIZE_THRESHOLD", ".35");  /* 0-remove all, 1-remove none */
 
+    // Partition among the nodes first and then among the processes of
+    // each node. Pointless if there is only one node or process per node.
+    HierarchicalLevels levels{ node_topology, cc.rank() };
+    if ( node_topology && node_topology->numNodes() > 1
+         && node_topology->numNodes() < cc.size() )
+    {
+        Zoltan_Set_Param(zz, "LB_METHOD", "HIER");
+        Zoltan_Set_Hier_Num_Levels_Fn(zz, getHierNumLevels, &levels);
+        Zoltan_Set_Hier_Part_Fn(zz, getHierPart, &levels);
+        Zoltan_Set_Hier_Method_Fn(zz, setHierMethod, &levels);
+    }
+
     // For the load balancer one process has the whole grid and
     // all others an empty partition before loadbalancing.
     bool partitionIsEmpty     = cc.rank()!=root;
@@ -69,13 +118,16 @@ zoltanGraphPartitionGridOnRoot(const CpGrid& cpgrid,
 
     std::shared_ptr<CombinedGridWellGraph> grid_and_wells;
 
-    if( wells )
+    if( wells || nncs )
     {
         Zoltan_Set_Param(zz,"EDGE_WEIGHT_DIM","1");
+        // The vertices of the wells carry the number of their cells.
+        Zoltan_Set_Param(zz, "OBJ_WEIGHT_DIM", "1");
         grid_and_wells.reset(new CombinedGridWellGraph(cpgrid,
                                                        wells,
                                                        transmissibilities,
-                                                       partitionIsEmpty));
+                                                       partitionIsEmpty,
+                                                       nncs));
         Dune::cpgrid::setCpGridZoltanGraphFunctions(zz, *grid_and_wells,
                                                     partitionIsEmpty);
     }
@@ -100,12 +152,31 @@ zoltanGraphPartitionGridOnRoot(const CpGrid& cpgrid,
                              &exportToPart);  /* Partition to which each vertex will belong */
     int                         size = cpgrid.numCells();
     int                         rank  = cc.rank();
+    // Only the root needs the grid, the others may not have built it.
+    cc.broadcast(&size, 1, root);
     std::vector<int>            parts(size, rank);
     std::vector<std::vector<int> > wells_on_proc;
+    std::size_t                 moved_cells = 0;
 
-    for ( int i=0; i < numExport; ++i )
+    if( grid_and_wells && partitionIsWholeGrid )
     {
-        parts[exportLocalGids[i]] = exportProcs[i];
+        // Zoltan partitioned the graph with contracted wells.
+        std::vector<int> vertex_parts(grid_and_wells->numVertices(), rank);
+        for ( int i=0; i < numExport; ++i )
+        {
+            vertex_parts[exportLocalGids[i]] = exportProcs[i];
+        }
+        for ( int cell = 0; cell < size; ++cell )
+        {
+            parts[cell] = vertex_parts[grid_and_wells->vertexOfCell(cell)];
+        }
+    }
+    else
+    {
+        for ( int i=0; i < numExport; ++i )
+        {
+            parts[exportLocalGids[i]] = exportProcs[i];
+        }
     }
 
     if( wells && partitionIsWholeGrid )
@@ -114,26 +185,14 @@ zoltanGraphPartitionGridOnRoot(const CpGrid& cpgrid,
             postProcessPartitioningForWells(parts,
                                             *wells,
                                             grid_and_wells->getWellConnections(),
-                                            cc.size());
+                                            cc.size(),
+                                            &moved_cells);
 
 #ifndef NDEBUG
-        int index = 0;
-        for( auto well : grid_and_wells->getWellsGraph() )
+        // The contraction of the wells already keeps them on one process.
+        if ( moved_cells )
         {
-            int part=parts[index];
-            std::set<std::pair<int,int> > cells_on_other;
-            for( auto vertex : well )
-            {
-                if( part != parts[vertex] )
-                {
-                    cells_on_other.insert(std::make_pair(vertex, parts[vertex]));
-                }
-            }
-            if ( cells_on_other.size() )
-            {
-                OPM_THROW(std::domain_error, "Well is distributed between processes, which should not be the case!");
-            }
-            ++index;
+            OPM_THROW(std::domain_error, "Well is distributed between processes, which should not be the case!");
         }
 #endif
     }
@@ -153,8 +212,9 @@ zoltanGraphPartitionGridOnRoot(const CpGrid& cpgrid,
     }
 
     cc.broadcast(&parts[0], parts.size(), root);
+    cc.broadcast(&moved_cells, 1, root);
 
-    return std::make_pair(parts, defunct_well_names);
+    return std::make_tuple(parts, defunct_well_names, moved_cells);
 }
 }
 }
@@ -20,10 +20,12 @@
 #ifndef DUNE_CPGRID_ZOLTANPARTITION_HEADER
 #define DUNE_CPGRID_ZOLTANPARTITION_HEADER
 
+#include <tuple>
 #include <unordered_set>
 
 #include <opm/grid/CpGrid.hpp>
 #include <opm/grid/common/ZoltanGraphFunctions.hpp>
+#include <opm/grid/common/NodeTopology.hpp>
 
 #if defined(HAVE_ZOLTAN) && defined(HAVE_MPI)
 namespace Dune
@@ -43,16 +45,24 @@ namespace cpgrid
 /// @paramm cc  The MPI communicator to use for the partitioning.
 ///             The will be partitioned among the partiticipating processes.
 /// @param root The process number that holds the global grid.
-/// @return A pair consisting of a vector that contains for each local cell of the grid the
+/// @param nncs Non-neighbour connections with compressed cell indices that
+///             are added as edges to the graph, or null.
+/// @param node_topology If not null, the grid is partitioned among the
+///             nodes first, minimizing the cut between them, and then
+///             among the processes of each node. Its ranks refer to cc.
+/// @return A tuple consisting of a vector that contains for each local cell of the grid the
 ///         the number of the process that owns it after repartitioning,
-///         and a set of names of wells that should be defunct in a parallel
-///         simulation.
-std::pair<std::vector<int>,std::unordered_set<std::string> >
+///         a set of names of wells that should be defunct in a parallel
+///         simulation, and the number of cells moved to keep each well
+///         on one process.
+std::tuple<std::vector<int>,std::unordered_set<std::string>,std::size_t>
 zoltanGraphPartitionGridOnRoot(const CpGrid& grid,
                                const std::vector<const OpmWellType*> * wells,
                                const double* transmissibilities,
                                const CollectiveCommunication<MPI_Comm>& cc,
-                               int root);
+                               int root,
+                               const std::vector<NonNeighbourConnection>* nncs = nullptr,
+                               const NodeTopology* node_topology = nullptr);
 }
 }
 #endif // HAVE_ZOLTAN
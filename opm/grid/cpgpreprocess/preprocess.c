@@ -32,6 +32,12 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+/* clock_gettime() is POSIX, hence hidden by -std=c99 otherwise. */
+#if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 199309L
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
 #include "config.h"
 #include <assert.h>
 #include <float.h>
@@ -39,6 +45,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "preprocess.h"
 #include "uniquepoints.h"
@@ -755,12 +762,49 @@ reverse_face_nodes(struct processed_grid *out)
 }
 
 
+/*-----------------------------------------------------------------
+  Wall-clock time in seconds from an arbitrary origin, monotonic if
+  the platform provides such a clock.
+*/
+static double
+wall_seconds(void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + 1.0e-9 * (double) ts.tv_nsec;
+#else
+    return (double) time(NULL);
+#endif
+}
+
+
+/*-----------------------------------------------------------------
+  Wall-clock time in seconds since "start".
+*/
+static double
+seconds_since(double start)
+{
+    return wall_seconds() - start;
+}
+
+
 /*-----------------------------------------------------------------
   Public interface
 */
 void process_grdecl(const struct grdecl   *in,
                     double                tolerance,
                     struct processed_grid *out)
+{
+    struct processed_grid_timings timings;
+    process_grdecl_timed(in, tolerance, out, &timings);
+}
+
+
+void process_grdecl_timed(const struct grdecl            *in,
+                          double                          tolerance,
+                          struct processed_grid          *out,
+                          struct processed_grid_timings  *timings)
 {
     struct grdecl g;
 
@@ -784,6 +828,8 @@ void process_grdecl(const struct grdecl   *in,
     int    *plist;
     int    *intersections;
 
+    double  start;
+
 
 
 
@@ -812,6 +858,10 @@ void process_grdecl(const struct grdecl   *in,
     out->node_coordinates = NULL;
     out->local_cell_index = malloc(nc * sizeof *out->local_cell_index);
 
+    timings->unique_points    = 0.0;
+    timings->vertical_faces   = 0.0;
+    timings->horizontal_faces = 0.0;
+
 
 
     /* Do actual work here:*/
@@ -843,7 +893,9 @@ void process_grdecl(const struct grdecl   *in,
      * padding */
     plist = malloc(8 * (nc + ((size_t)nx)*((size_t)ny)) * sizeof *plist);
 
+    start = wall_seconds();
     finduniquepoints(&g, plist, tolerance, out);
+    timings->unique_points = seconds_since(start);
 
     free (zcorn);
     free (actnum);
@@ -870,9 +922,14 @@ void process_grdecl(const struct grdecl   *in,
 
 
 
+    start = wall_seconds();
     process_vertical_faces   (0, &intersections, plist, work, out);
     process_vertical_faces   (1, &intersections, plist, work, out);
+    timings->vertical_faces = seconds_since(start);
+
+    start = wall_seconds();
     process_horizontal_faces (   &intersections, plist,       out);
+    timings->horizontal_faces = seconds_since(start);
 
     free (plist);
     free (work);
@@ -107,6 +107,17 @@ extern "C" {
     };
 
 
+    /**
+     * Wall-clock time in seconds spent in the stages of function
+     * process_grdecl_timed().
+     */
+    struct processed_grid_timings {
+        double unique_points;    /**< Finding the unique points. */
+        double vertical_faces;   /**< Processing the vertical faces. */
+        double horizontal_faces; /**< Processing the horizontal faces. */
+    };
+
+
     /**
      * Construct a prototypical grid representation from a corner-point
      * specification.
@@ -130,6 +141,20 @@ extern "C" {
                         double                 tol,
                         struct processed_grid *out);
 
+    /**
+     * Like function process_grdecl(), but also measure the wall-clock time
+     * of the processing stages.
+     *
+     * @param[in]     g       Corner-point specification, see process_grdecl().
+     * @param[in]     tol     Absolute tolerance of node-coincidence.
+     * @param[in,out] out     Minimal grid representation, see process_grdecl().
+     * @param[out]    timings Time spent in each stage.
+     */
+    void process_grdecl_timed(const struct grdecl            *g  ,
+                              double                          tol,
+                              struct processed_grid          *out,
+                              struct processed_grid_timings  *timings);
+
     /**
      * Release memory resources acquired in previous grid processing using
      * function process_grdecl().
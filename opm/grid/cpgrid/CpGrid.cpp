@@ -48,9 +48,20 @@
 #include <opm/grid/common/ZoltanPartition.hpp>
 #include <opm/grid/common/GridPartitioning.hpp>
 #include <opm/grid/common/WellConnections.hpp>
+#include <opm/grid/common/NodeSharedGlobalGrid.hpp>
+#include <opm/grid/common/NodeSharedGrdecl.hpp>
+#include <opm/grid/common/NodeTopology.hpp>
+#include <opm/grid/common/PartitionCache.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <numeric>
+#include <tuple>
+
+#include <sys/stat.h>
 
 namespace Dune
 {
@@ -68,11 +79,14 @@ namespace Dune
 
 std::pair<bool, std::unordered_set<std::string> >
 CpGrid::scatterGrid(const std::vector<const cpgrid::OpmWellType *> * wells,
-                    const double* transmissibilities, int overlapLayers)
+                    const double* transmissibilities,
+                    const std::vector<cpgrid::NonNeighbourConnection>* nncs,
+                    int overlapLayers)
 {
     // Silence any unused argument warnings that could occur with various configurations.
     static_cast<void>(wells);
     static_cast<void>(transmissibilities);
+    static_cast<void>(nncs);
     static_cast<void>(overlapLayers);
 #if HAVE_MPI
     if(distributed_data_)
@@ -85,46 +99,129 @@ CpGrid::scatterGrid(const std::vector<const cpgrid::OpmWellType *> * wells,
     CollectiveCommunication cc(MPI_COMM_WORLD);
 
     int my_num=cc.rank();
-#ifdef HAVE_ZOLTAN
-    auto part_and_wells =
-        cpgrid::zoltanGraphPartitionGridOnRoot(*this, wells, transmissibilities, cc, 0);
-    int num_parts = cc.size();
-    using std::get;
-    auto cell_part = std::get<0>(part_and_wells);
-    auto defunct_wells = std::get<1>(part_and_wells);
-#else
-    std::vector<int> cell_part(current_view_data_->global_cell_.size());
-    int  num_parts=-1;
-    std::array<int, 3> initial_split;
-    initial_split[1]=initial_split[2]=std::pow(cc.size(), 1.0/3.0);
-    initial_split[0]=cc.size()/(initial_split[1]*initial_split[2]);
-    partition(*this, initial_split, num_parts, cell_part, false, false);
-    const auto& cpgdim =  logicalCartesianSize();
-    std::vector<int> cartesian_to_compressed(cpgdim[0]*cpgdim[1]*cpgdim[2], -1);
-    for( int i=0; i < numCells(); ++i )
+    cpgrid::PhaseTimings::Scope partition_timer(data_->phase_timings_, cpgrid::GridPhase::Partitioning);
+
+    // A global grid read once per node is only complete on process 0,
+    // hence the others take what they need from the shared copy.
+    const cpgrid::NodeSharedGlobalGrid* shared_grid = node_shared_grid_.get();
+    const int num_global_cells = shared_grid ? shared_grid->numCells() : numCells();
+    const int* global_cell = shared_grid ? shared_grid->globalCell() : globalCell().data();
+    const std::array<int, 3> cpgdim = shared_grid ? shared_grid->logicalCartesianSize()
+        : logicalCartesianSize();
+    std::vector<int> cartesian_to_compressed;
+    if ( wells || ( nncs && !nncs->empty() ) )
     {
-        cartesian_to_compressed[globalCell()[i]] = i;
+        cartesian_to_compressed.assign(cpgdim[0]*cpgdim[1]*cpgdim[2], -1);
+        for( int i=0; i < num_global_cells; ++i )
+        {
+            cartesian_to_compressed[global_cell[i]] = i;
+        }
     }
 
-    std::unordered_set<std::string> defunct_wells;
+    // The non-neighbour connections between active cells with compressed indices.
+    std::vector<cpgrid::NonNeighbourConnection> compressed_nncs;
+    if ( nncs && !nncs->empty() )
+    {
+        compressed_nncs.reserve(nncs->size());
+        for ( const auto& nnc : *nncs )
+        {
+            const int c1 = cartesian_to_compressed[nnc.cell1];
+            const int c2 = cartesian_to_compressed[nnc.cell2];
+            if ( c1 >= 0 && c2 >= 0 && c1 != c2 )
+            {
+                compressed_nncs.push_back({ c1, c2, nnc.trans });
+            }
+        }
+    }
 
+    cpgrid::WellConnections well_connections;
     if ( wells )
     {
-        cpgrid::WellConnections well_connections(*wells,
-                                                 cpgdim,
-                                                 cartesian_to_compressed);
+        well_connections.init(*wells, cpgdim, cartesian_to_compressed);
+    }
+
+    std::vector<int> cell_part;
+    std::unordered_set<std::string> defunct_wells;
+    std::size_t moved_cells = 0;
+    int num_parts = cc.size();
+
+    // The node layout is part of the stored partition, too.
+    const cpgrid::NodeTopology& node_topology = nodeTopology();
+
+    // Try to reuse the partition of an earlier run. Only the root reads the
+    // file, the result is broadcast to the others.
+    std::uint64_t partition_hash = 0;
+    int partition_read = 0;
+    if ( !partition_file_.empty() )
+    {
+        if ( my_num == 0 )
+        {
+            partition_hash = cpgrid::partitionHash(*this, well_connections, compressed_nncs,
+                                                   transmissibilities, cc.size(),
+                                                   node_aware_partitioning_,
+                                                   node_topology.node_of_rank);
+            partition_read = cpgrid::readPartition(partition_file_, partition_hash,
+                                                   numCells(), cell_part, num_parts);
+        }
+        cc.broadcast(&partition_read, 1, 0);
+        if ( partition_read )
+        {
+            cc.broadcast(&num_parts, 1, 0);
+            cell_part.resize(num_global_cells);
+            cc.broadcast(cell_part.data(), cell_part.size(), 0);
+        }
+    }
 
+    if ( !partition_read )
+    {
+#ifdef HAVE_ZOLTAN
+        std::tie(cell_part, defunct_wells, moved_cells) =
+            cpgrid::zoltanGraphPartitionGridOnRoot(*this, wells, transmissibilities, cc, 0,
+                                                   compressed_nncs.empty() ? nullptr : &compressed_nncs,
+                                                   node_aware_partitioning_ ? &node_topology : nullptr);
+#else
+        cell_part.resize(num_global_cells);
+        std::array<int, 3> initial_split;
+        initial_split[1]=initial_split[2]=std::pow(cc.size(), 1.0/3.0);
+        initial_split[0]=cc.size()/(initial_split[1]*initial_split[2]);
+        if ( !shared_grid || my_num == 0 )
+        {
+            partition(*this, initial_split, num_parts, cell_part, false, false);
+        }
+        if ( shared_grid )
+        {
+            cc.broadcast(&num_parts, 1, 0);
+            cc.broadcast(cell_part.data(), cell_part.size(), 0);
+        }
+#endif
+    }
+
+#ifdef HAVE_ZOLTAN
+    const bool compute_defunct_wells = wells && partition_read;
+#else
+    const bool compute_defunct_wells = wells != nullptr;
+#endif
+    if ( compute_defunct_wells )
+    {
+        // A stored partition already keeps the wells on one process, hence
+        // this only determines the wells of each process.
         auto wells_on_proc =
             cpgrid::postProcessPartitioningForWells(cell_part,
                                                     *wells,
                                                     well_connections,
-                                                    cc.size());
+                                                    cc.size(),
+                                                    &moved_cells);
         defunct_wells = cpgrid::computeDefunctWellNames(wells_on_proc,
                                                         *wells,
                                                         cc,
                                                         0);
     }
-#endif
+
+    if ( !partition_file_.empty() && !partition_read && my_num == 0 )
+    {
+        cpgrid::writePartition(partition_file_, partition_hash, cell_part, num_parts);
+    }
+    partition_timer.stop();
 
     MPI_Comm new_comm = MPI_COMM_NULL;
 
@@ -147,8 +244,16 @@ CpGrid::scatterGrid(const std::vector<const cpgrid::OpmWellType *> * wells,
     if(my_num<cc.size())
     {
         distributed_data_.reset(new cpgrid::CpGridData(new_comm));
-        distributed_data_->distributeGlobalGrid(*this,*this->current_view_data_, cell_part,
-                                                overlapLayers);
+        if ( shared_grid )
+        {
+            distributed_data_->distributeGlobalGrid(*shared_grid, cell_part,
+                                                    overlapLayers, compressed_nncs);
+        }
+        else
+        {
+            distributed_data_->distributeGlobalGrid(*this,*this->current_view_data_, cell_part,
+                                                    overlapLayers, compressed_nncs);
+        }
         std::cout << "After loadbalancing process " << my_num << " has " <<
             distributed_data_->cell_to_face_.size() << " cells." << std::endl;
 
@@ -196,7 +301,10 @@ CpGrid::scatterGrid(const std::vector<const cpgrid::OpmWellType *> * wells,
                 indices.second.add(index.local());
             }
         }
+        computePartitionQuality(cell_part, transmissibilities, compressed_nncs, moved_cells);
     }
+    // Free the shared memory of the node, which is collective on it.
+    node_shared_grid_.reset();
     current_view_data_ = distributed_data_.get();
     return std::make_pair(true, defunct_wells);
 
@@ -251,6 +359,135 @@ CpGrid::scatterGrid(const std::vector<const cpgrid::OpmWellType *> * wells,
         current_view_data_->processEclipseFormat(g, 0.0, false, false);
     }
 
+    void CpGrid::reorderForLocality()
+    {
+        if (distributed_data_) {
+            OPM_THROW(std::logic_error, "The grid cannot be reordered after loadBalance() was called.");
+        }
+        current_view_data_->reorderForLocality();
+    }
+
+    cpgrid::GridMemoryUsage CpGrid::memoryUsage() const
+    {
+        cpgrid::GridMemoryUsage usage;
+        usage.global_view = data_->memoryUsage();
+        if (distributed_data_) {
+            usage.distributed_view = distributed_data_->memoryUsage();
+#if HAVE_MPI
+            usage.distributed_view.interfaces += cpgrid::interfaceMapBytes(*cell_scatter_gather_interfaces_);
+#endif
+        }
+        return usage;
+    }
+
+    cpgrid::PhaseTimings CpGrid::phaseTimings() const
+    {
+        cpgrid::PhaseTimings timings = data_->phase_timings_;
+        if (distributed_data_) {
+            timings += distributed_data_->phase_timings_;
+        }
+        return timings;
+    }
+
+    cpgrid::PhaseTimingReport CpGrid::phaseTimingReport() const
+    {
+        return cpgrid::PhaseTimingReport::create(phaseTimings(),
+                                                 MPIHelper::getCollectiveCommunication());
+    }
+
+#if HAVE_MPI
+    const cpgrid::NodeTopology& CpGrid::nodeTopology()
+    {
+        // The processes stay on their nodes, hence this is done once.
+        if (node_topology_.node_of_rank.empty()) {
+            node_topology_ = cpgrid::computeNodeTopology(MPI_COMM_WORLD);
+        }
+        return node_topology_;
+    }
+#endif
+
+    void CpGrid::computePartitionQuality(const std::vector<int>& cell_part,
+                                         const double* transmissibilities,
+                                         const std::vector<cpgrid::NonNeighbourConnection>& nncs,
+                                         std::size_t moved_cells)
+    {
+        static_cast<void>(cell_part);
+        static_cast<void>(transmissibilities);
+        static_cast<void>(nncs);
+        partition_quality_ = cpgrid::PartitionQualityReport();
+        partition_quality_.cells_moved_for_wells = moved_cells;
+#if HAVE_MPI
+        // Faces of the global grid whose cells have different owners,
+        // and of those the ones whose owners are on different nodes.
+        // The processes of a smaller communicator are the first ones of
+        // MPI_COMM_WORLD, and scatterGrid() already knows their nodes.
+        const auto& cc = distributed_data_->ccobj_;
+        const auto& node = nodeTopology().node_of_rank;
+        auto addCut = [&](int c0, int c1, double trans) {
+            if (cell_part[c0] != cell_part[c1]) {
+                ++partition_quality_.edge_cut;
+                partition_quality_.weighted_edge_cut += trans;
+                if (node[cell_part[c0]] != node[cell_part[c1]]) {
+                    ++partition_quality_.inter_node_edge_cut;
+                }
+            }
+        };
+        if (node_shared_grid_) {
+            const auto& grid = *node_shared_grid_;
+            for (int face = 0; face < grid.numFaces(); ++face) {
+                const auto cells = grid.faceCells(face);
+                if (cells.size() == 2) {
+                    addCut(cells[0].index(), cells[1].index(),
+                           transmissibilities ? transmissibilities[face] : 1.0);
+                }
+            }
+        } else {
+            const std::vector<int>& face_cells = data_->face_cells_;
+            for (std::size_t face = 0; face < face_cells.size() / 2; ++face) {
+                const int c0 = face_cells[2*face];
+                const int c1 = face_cells[2*face + 1];
+                if (c0 >= 0 && c1 >= 0) {
+                    addCut(c0, c1, transmissibilities ? transmissibilities[face] : 1.0);
+                }
+            }
+        }
+        for (const auto& nnc : nncs) {
+            addCut(nnc.cell1, nnc.cell2, transmissibilities ? nnc.trans : 1.0);
+        }
+
+        int owned = 0;
+        for (const auto& index : distributed_data_->cell_indexset_) {
+            if (index.local().attribute() == cpgrid::CpGridData::AttributeSet::owner) {
+                ++owned;
+            }
+        }
+        int neighbours = 0;
+        int sent = 0;
+        int received = 0;
+        const auto& interface =
+            std::get<InteriorBorder_All_Interface>(distributed_data_->cell_interfaces_);
+        for (const auto& process : interface.interfaces()) {
+            const int num_send = process.second.first.size();
+            const int num_recv = process.second.second.size();
+            neighbours += (num_send + num_recv) > 0;
+            sent += num_send;
+            received += num_recv;
+        }
+
+        int local[5] = { owned, distributed_data_->size(0) - owned,
+                         neighbours, sent, received };
+        std::vector<int> all(5 * cc.size());
+        cc.allgather(local, 5, all.data());
+        for (int rank = 0; rank < cc.size(); ++rank) {
+            partition_quality_.owned_cells.push_back(all[5*rank]);
+            partition_quality_.overlap_cells.push_back(all[5*rank + 1]);
+            partition_quality_.neighbour_ranks.push_back(all[5*rank + 2]);
+            partition_quality_.halo_cells_sent.push_back(all[5*rank + 3]);
+            partition_quality_.halo_cells_received.push_back(all[5*rank + 4]);
+        }
+#endif
+    }
+
     void CpGrid::readSintefLegacyFormat(const std::string& grid_prefix)
     {
         current_view_data_->readSintefLegacyFormat(grid_prefix);
@@ -259,7 +496,231 @@ CpGrid::scatterGrid(const std::vector<const cpgrid::OpmWellType *> * wells,
     {
         current_view_data_->writeSintefLegacyFormat(grid_prefix);
     }
+    void CpGrid::readBinaryFormat(const std::string& filename)
+    {
+        current_view_data_->readBinaryFormat(filename);
+    }
+    void CpGrid::writeBinaryFormat(const std::string& filename) const
+    {
+        current_view_data_->writeBinaryFormat(filename);
+    }
+    void CpGrid::processUnstructuredGrid(const UnstructuredGrid& grid)
+    {
+        current_view_data_->processUnstructuredGrid(grid);
+    }
+    void CpGrid::fillUnstructuredGridView(cpgrid::UnstructuredGridView& view) const
+    {
+        current_view_data_->fillUnstructuredGridView(view);
+    }
 
+    namespace
+    {
+        std::string checkpointFileName(const std::string& directory, int rank)
+        {
+            return directory + "/rank-" + std::to_string(rank) + ".grid";
+        }
+    } // anonymous namespace
+
+    void CpGrid::writeCheckpoint(const std::string& directory) const
+    {
+        if (!distributed_data_ || current_view_data_ != distributed_data_.get()) {
+            OPM_THROW(std::logic_error, "Only a distributed grid can be checkpointed, "
+                      "call loadBalance() first.");
+        }
+        const auto& cc = distributed_data_->ccobj_;
+        if (cc.rank() == 0) {
+            // An existing directory is fine, other failures show when writing.
+            ::mkdir(directory.c_str(), 0755);
+        }
+        cc.barrier();
+        distributed_data_->writeCheckpoint(checkpointFileName(directory, cc.rank()));
+    }
+
+    void CpGrid::readCheckpoint(const std::string& directory)
+    {
+#if HAVE_MPI
+        // Like loadBalance(), the grid is distributed among all processes.
+        distributed_data_.reset(new cpgrid::CpGridData(MPI_COMM_WORLD));
+        distributed_data_->readCheckpoint(checkpointFileName(directory,
+                                                             distributed_data_->ccobj_.rank()));
+        cell_scatter_gather_interfaces_.reset(new InterfaceMap);
+        incomplete_global_view_ = true;
+        current_view_data_ = distributed_data_.get();
+#else
+        static_cast<void>(directory);
+        OPM_THROW(std::runtime_error, "Restoring a distributed grid needs MPI.");
+#endif
+    }
+
+
+    namespace
+    {
+        /// The cells sorted by their logical Cartesian index.
+        std::vector<int> cellsInCartesianOrder(const std::vector<int>& global_cell)
+        {
+            std::vector<int> order(global_cell.size());
+            std::iota(order.begin(), order.end(), 0);
+            if (!std::is_sorted(global_cell.begin(), global_cell.end())) {
+                std::sort(order.begin(), order.end(), [&global_cell](int a, int b) {
+                        return global_cell[a] < global_cell[b];
+                    });
+            }
+            return order;
+        }
+
+        /// Copies raw cell values from owner to overlap cells.
+        class RawCellDataHandle
+        {
+        public:
+            RawCellDataHandle(char* values, std::size_t value_size)
+                : values_(values), value_size_(value_size)
+            {}
+            typedef char DataType;
+            bool fixedsize(int /*dim*/, int /*codim*/)
+            {
+                return true;
+            }
+            bool contains(int /*dim*/, int codim)
+            {
+                return codim == 0;
+            }
+            template<class T>
+            std::size_t size(const T&)
+            {
+                return value_size_;
+            }
+            template<class B, class T>
+            void gather(B& buffer, const T& t)
+            {
+                const char* value = values_ + t.index() * value_size_;
+                for (std::size_t i = 0; i < value_size_; ++i) {
+                    buffer.write(value[i]);
+                }
+            }
+            template<class B, class T>
+            void scatter(B& buffer, const T& t, std::size_t)
+            {
+                char* value = values_ + t.index() * value_size_;
+                for (std::size_t i = 0; i < value_size_; ++i) {
+                    buffer.read(value[i]);
+                }
+            }
+        private:
+            char* values_;
+            std::size_t value_size_;
+        };
+    } // anonymous namespace
+
+    void CpGrid::scatterCellChunks(const std::function<void(std::size_t, std::size_t, char*)>& producer,
+                                   std::size_t value_size, char* values, std::size_t chunk_size)
+    {
+        chunk_size = std::max(chunk_size, std::size_t(1));
+        const auto& dims = logicalCartesianSize();
+        const std::size_t cartesian_size = std::size_t(dims[0]) * dims[1] * dims[2];
+        std::vector<char> chunk;
+
+        if (!distributed_data_ || current_view_data_ != distributed_data_.get()) {
+            // Every process holds all cells.
+            const std::vector<int>& global_cell = current_view_data_->global_cell_;
+            const std::vector<int> order = cellsInCartesianOrder(global_cell);
+            auto cell = order.begin();
+            for (std::size_t begin = 0; begin < cartesian_size; begin += chunk_size) {
+                const std::size_t end = std::min(begin + chunk_size, cartesian_size);
+                chunk.resize((end - begin) * value_size);
+                producer(begin, end, chunk.data());
+                for (; cell != order.end() && std::size_t(global_cell[*cell]) < end; ++cell) {
+                    std::memcpy(values + *cell * value_size,
+                                chunk.data() + (global_cell[*cell] - begin) * value_size,
+                                value_size);
+                }
+            }
+            return;
+        }
+
+#if HAVE_MPI
+        if (cell_scatter_gather_interfaces_->empty()) {
+            OPM_THROW(std::logic_error, "Scattering needs the global grid, which a grid "
+                      "restored from a checkpoint lacks.");
+        }
+        const auto& cc = distributed_data_->ccobj_;
+        MPI_Comm comm = cc;
+        const int tag = 4711;
+        // The owner cells of this process, in the order of the send lists of process 0.
+        const auto& owned = (*cell_scatter_gather_interfaces_)[0].second;
+        // A record is the position in the owner's list followed by the value.
+        const std::size_t record_size = sizeof(int) + value_size;
+        std::size_t received = 0;
+        auto unpack = [&](const char* buffer, std::size_t bytes) {
+            for (const char* record = buffer; record != buffer + bytes; record += record_size) {
+                int position;
+                std::memcpy(&position, record, sizeof(int));
+                std::memcpy(values + owned[position] * value_size, record + sizeof(int), value_size);
+                ++received;
+            }
+        };
+
+        if (cc.rank() == 0) {
+            const std::vector<int>& global_cell = data_->global_cell_;
+            std::vector<int> owner(global_cell.size()), position(global_cell.size());
+            for (const auto& proc_lists : *cell_scatter_gather_interfaces_) {
+                const auto& send = proc_lists.second.first;
+                for (std::size_t i = 0; i < send.size(); ++i) {
+                    owner[send[i]] = proc_lists.first;
+                    position[send[i]] = i;
+                }
+            }
+            const std::vector<int> order = cellsInCartesianOrder(global_cell);
+            std::map<int, std::vector<char> > buffers;
+            std::vector<MPI_Request> requests;
+            requests.reserve(cc.size());
+            auto cell = order.begin();
+            for (std::size_t begin = 0; begin < cartesian_size; begin += chunk_size) {
+                const std::size_t end = std::min(begin + chunk_size, cartesian_size);
+                chunk.resize((end - begin) * value_size);
+                producer(begin, end, chunk.data());
+                for (auto& buffer : buffers) {
+                    buffer.second.clear();
+                }
+                for (; cell != order.end() && std::size_t(global_cell[*cell]) < end; ++cell) {
+                    auto& buffer = buffers[owner[*cell]];
+                    const char* pos = reinterpret_cast<const char*>(&position[*cell]);
+                    buffer.insert(buffer.end(), pos, pos + sizeof(int));
+                    const char* value = chunk.data() + (global_cell[*cell] - begin) * value_size;
+                    buffer.insert(buffer.end(), value, value + value_size);
+                }
+                requests.clear();
+                for (auto& buffer : buffers) {
+                    if (buffer.second.empty()) {
+                        continue;
+                    }
+                    if (buffer.first == 0) {
+                        unpack(buffer.second.data(), buffer.second.size());
+                    } else {
+                        requests.emplace_back();
+                        MPI_Isend(buffer.second.data(), buffer.second.size(), MPI_BYTE,
+                                  buffer.first, tag, comm, &requests.back());
+                    }
+                }
+                // The buffers are reused for the next chunk.
+                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+            }
+        } else {
+            std::vector<char> buffer;
+            while (received < owned.size()) {
+                MPI_Status status;
+                MPI_Probe(0, tag, comm, &status);
+                int bytes;
+                MPI_Get_count(&status, MPI_BYTE, &bytes);
+                buffer.resize(bytes);
+                MPI_Recv(buffer.data(), bytes, MPI_BYTE, 0, tag, comm, MPI_STATUS_IGNORE);
+                unpack(buffer.data(), bytes);
+            }
+        }
+
+        RawCellDataHandle handle(values, value_size);
+        communicate(handle, InteriorBorder_All_Interface, ForwardCommunication);
+#endif
+    }
 
 #if HAVE_ECL_INPUT
     void CpGrid::processEclipseFormat(const Opm::EclipseGrid& ecl_grid,
@@ -279,4 +740,37 @@ CpGrid::scatterGrid(const std::vector<const cpgrid::OpmWellType *> * wells,
         current_view_data_->processEclipseFormat(input_data, z_tolerance, remove_ij_boundary, turn_normals);
     }
 
+#if HAVE_MPI
+    void CpGrid::processEclipseFormat(const cpgrid::NodeSharedGrdecl& input_data, double z_tolerance,
+                                      bool remove_ij_boundary, bool turn_normals)
+    {
+        int result;
+        MPI_Comm_compare(input_data.comm(), MPI_COMM_WORLD, &result);
+        if (result != MPI_IDENT && result != MPI_CONGRUENT) {
+            OPM_THROW(std::invalid_argument, "The input has to be distributed over MPI_COMM_WORLD.");
+        }
+        int rank;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        // Rank 0 has the smallest key and therefore leads its node.
+        MPI_Comm node_comm;
+        MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm);
+        int node_rank;
+        MPI_Comm_rank(node_comm, &node_rank);
+
+        if (node_rank == 0) {
+            current_view_data_->processEclipseFormat(input_data.input(), z_tolerance,
+                                                     remove_ij_boundary, turn_normals);
+        }
+        node_shared_grid_ = std::make_shared<cpgrid::NodeSharedGlobalGrid>(*current_view_data_, node_comm);
+        MPI_Comm_free(&node_comm);
+        incomplete_global_view_ = true;
+
+        // Only process 0 partitions the grid and keeps its own copy.
+        if (node_rank == 0 && rank != 0) {
+            data_.reset(new cpgrid::CpGridData(*this));
+            current_view_data_ = data_.get();
+        }
+    }
+#endif
+
 } // namespace Dune
@@ -1,6 +1,7 @@
 #include"config.h"
 #include <algorithm>
 #include <map>
+#include <utility>
 #include <vector>
 #include"CpGridData.hpp"
 #include"Intersection.hpp"
@@ -13,6 +14,7 @@
 #include <opm/grid/utility/platform_dependent/disable_warnings.h>
 
 #include <opm/grid/common/GridPartitioning.hpp>
+#include <opm/grid/common/NodeSharedGlobalGrid.hpp>
 #include <dune/common/parallel/remoteindices.hh>
 #include <dune/common/enumset.hh>
 #include <opm/grid/utility/SparseTable.hpp>
@@ -129,6 +131,23 @@ void CpGridData::computeUniqueBoundaryIds()
 #endif
 }
 
+void CpGridData::computeFaceCells()
+{
+    const int num_faces = face_to_cell_.size();
+    std::vector<int> face_cells(2*num_faces, -1);
+    for (int f = 0; f < num_faces; ++f) {
+        for (const auto& cell : face_to_cell_[EntityRep<1>(f, true)]) {
+            // Along the front partition cells not present on this process
+            // are marked with std::numeric_limits<int>::max().
+            if (cell.index() == std::numeric_limits<int>::max()) {
+                continue;
+            }
+            face_cells[2*f + (cell.orientation() ? 0 : 1)] = cell.index();
+        }
+    }
+    face_cells_.swap(face_cells);
+}
+
 int CpGridData::size(int codim) const
 {
     switch (codim) {
@@ -140,6 +159,144 @@ int CpGridData::size(int codim) const
     }
 }
 
+const std::vector<int>* CpGridData::partitionEntities(int codim, PartitionIteratorType pitype) const
+{
+    if(partition_type_indicator_->cell_indicator_.empty())
+        // Not distributed, all entities are interior.
+        return nullptr;
+    if(pitype!=Interior_Partition && pitype!=InteriorBorder_Partition &&
+       pitype!=Overlap_Partition)
+        return nullptr;
+    switch (codim) {
+    case 0: return &partition_entities_[0][pitype];
+    case 3: return &partition_entities_[1][pitype];
+    default: return nullptr;
+    }
+}
+
+namespace
+{
+template<int codim>
+void fillPartitionEntities(const PartitionTypeIndicator& indicator, int size,
+                           std::array<std::vector<int>, 3>& lists)
+{
+    for(auto& list : lists)
+    {
+        list.clear();
+        list.reserve(size);
+    }
+    for(int i=0; i<size; ++i)
+    {
+        PartitionType type=indicator.getPartitionType(EntityRep<codim>(i, true));
+        if(type==InteriorEntity)
+            lists[Interior_Partition].push_back(i);
+        if(type==InteriorEntity || type==BorderEntity)
+            lists[InteriorBorder_Partition].push_back(i);
+        if(type!=FrontEntity)
+            lists[Overlap_Partition].push_back(i);
+    }
+    for(auto& list : lists)
+        list.shrink_to_fit();
+}
+} // end anonymous namespace
+
+void CpGridData::computePartitionEntities()
+{
+    fillPartitionEntities<0>(*partition_type_indicator_, size(0), partition_entities_[0]);
+    fillPartitionEntities<3>(*partition_type_indicator_, size(3), partition_entities_[1]);
+}
+
+namespace
+{
+template<class T>
+std::size_t vectorBytes(const std::vector<T>& vec)
+{
+    return vec.capacity() * sizeof(T);
+}
+
+template<class T>
+std::size_t tableBytes(const Opm::SparseTable<T>& table)
+{
+    return table.dataSize() * sizeof(T) + (table.size() + 1) * sizeof(int);
+}
+
+#if HAVE_MPI
+template<class RemoteIndices>
+std::size_t remoteIndicesBytes(const RemoteIndices& remote_indices)
+{
+    typedef typename RemoteIndices::RemoteIndex RemoteIndex;
+    std::size_t bytes = 0;
+    for (auto it = remote_indices.begin(); it != remote_indices.end(); ++it) {
+        // Each list element holds the remote index and a pointer to the next one.
+        std::size_t entries = it->second.first->size();
+        if (it->second.second != it->second.first) {
+            entries += it->second.second->size();
+        }
+        bytes += entries * (sizeof(RemoteIndex) + sizeof(void*));
+    }
+    return bytes;
+}
+#endif
+} // end anonymous namespace
+
+MemoryUsage CpGridData::memoryUsage() const
+{
+    MemoryUsage usage;
+    usage.topology = tableBytes<EntityRep<1> >(cell_to_face_)
+        + tableBytes<EntityRep<0> >(face_to_cell_)
+        + vectorBytes(face_cells_)
+        + tableBytes(face_to_point_)
+        + vectorBytes(cell_to_point_);
+
+    usage.geometry = vectorBytes<Geometry<3, 3> >(geomVector<0>())
+        + vectorBytes<Geometry<2, 3> >(geomVector<1>())
+        + vectorBytes<Geometry<0, 3> >(geomVector<3>())
+        + vectorBytes<PointType>(face_normals_);
+
+    usage.entity_data = vectorBytes(global_cell_)
+        + vectorBytes<enum face_tag>(face_tag_)
+        + vectorBytes<int>(unique_boundary_ids_)
+        + vectorBytes(partition_type_indicator_->cell_indicator_)
+        + vectorBytes(partition_type_indicator_->point_indicator_);
+    for (const auto& lists : partition_entities_) {
+        for (const auto& list : lists) {
+            usage.entity_data += vectorBytes(list);
+        }
+    }
+    for (const auto& indices : original_index_) {
+        usage.entity_data += vectorBytes(indices);
+    }
+
+    usage.zcorn = vectorBytes(zcorn);
+
+    usage.index_sets = sizeof(IndexSet) + sizeof(IdSet);
+    usage.global_id_set = sizeof(GlobalIdSet)
+        + vectorBytes(global_id_set_->getMapping<0>())
+        + vectorBytes(global_id_set_->getMapping<1>())
+        + vectorBytes(global_id_set_->getMapping<3>());
+
+#if HAVE_MPI
+    usage.index_sets += cell_indexset_.size() * sizeof(ParallelIndexSet::IndexPair);
+    usage.remote_indices = remoteIndicesBytes(cell_remote_indices_);
+    usage.interfaces = interfaceMapBytes(std::get<0>(cell_interfaces_).interfaces())
+        + interfaceMapBytes(std::get<1>(cell_interfaces_).interfaces())
+        + interfaceMapBytes(std::get<2>(cell_interfaces_).interfaces())
+        + interfaceMapBytes(std::get<3>(cell_interfaces_).interfaces())
+        + interfaceMapBytes(std::get<4>(cell_interfaces_).interfaces())
+        + interfaceMapBytes(std::get<0>(point_interfaces_))
+        + interfaceMapBytes(std::get<1>(point_interfaces_))
+        + interfaceMapBytes(std::get<2>(point_interfaces_))
+        + interfaceMapBytes(std::get<3>(point_interfaces_))
+        + interfaceMapBytes(std::get<4>(point_interfaces_))
+        + interfaceMapBytes(cell_gather_scatter_interface)
+        + interfaceMapBytes(point_gather_scatter_interface);
+#endif
+
+    // The cells of each view read their corners from its point geometries.
+    usage.saved_vertex_copy = geomVector<3>().size() * sizeof(PointType);
+    return usage;
+}
+
 #if HAVE_MPI
 
  // A functor that counts existent entries and renumbers them.
@@ -166,12 +323,12 @@ struct AssignAndIncrement
  * @brief Counts the number of global ids and sets them up.
  * @param indicator A vector indicating whether an entity exists.
  * @param ids A vector to the the global ids in.
- * @param idSet The idSet of the global grid.
+ * @param id The id of an entity of the global grid given its index.
  * @return the number of entities that exist.
  */
-template<int codim>
+template<class GetId>
 int setupAndCountGlobalIds(const std::vector<int>& indicator, std::vector<int>& ids,
-                           const IdSet& idSet)
+                           GetId id)
 {
     int count = std::count_if(indicator.begin(),
                               indicator.end(),
@@ -183,7 +340,7 @@ int setupAndCountGlobalIds(const std::vector<int>& indicator, std::vector<int>&
         i!=iend; ++i)
     {
         if(*i<std::numeric_limits<int>::max())
-            ids[*i]=idSet.id(EntityRep<codim>(i-ibegin,true));
+            ids[*i]=id(i-ibegin);
     }
     return count;
 }
@@ -512,29 +669,112 @@ void createInterfaces(std::vector<std::map<int,char> >& attributes,
 
 }
 
-#endif // #if HAVE_MPI
+/// \brief Access to the global grid of a CpGridData with the interface of
+///        NodeSharedGlobalGrid.
+class CpGridData::GlobalGridView
+{
+public:
+    explicit GlobalGridView(const CpGridData& grid)
+        : grid_(grid)
+    {}
 
+    int numCells() const
+    {
+        return grid_.cell_to_face_.size();
+    }
+    int numFaces() const
+    {
+        return grid_.face_to_cell_.size();
+    }
+    int numPoints() const
+    {
+        return grid_.geomVector<3>().size();
+    }
+    OrientedEntityRange<1> cellFaces(int cell) const
+    {
+        return grid_.cell_to_face_[EntityRep<0>(cell, true)];
+    }
+    OrientedEntityRange<0> faceCells(int face) const
+    {
+        return grid_.face_to_cell_[EntityRep<1>(face, true)];
+    }
+    Opm::SparseTable<int>::row_type facePoints(int face) const
+    {
+        return grid_.face_to_point_[face];
+    }
+    const std::array<int, 8>& cellPoints(int cell) const
+    {
+        return grid_.cell_to_point_[cell];
+    }
+    int cellId(int cell) const
+    {
+        return grid_.local_id_set_->id(EntityRep<0>(cell, true));
+    }
+    int faceId(int face) const
+    {
+        return grid_.local_id_set_->id(EntityRep<1>(face, true));
+    }
+    int pointId(int point) const
+    {
+        return grid_.local_id_set_->id(EntityRep<3>(point, true));
+    }
+    const PointType& cellCenter(int cell) const
+    {
+        return grid_.geomVector<0>().get(cell).center();
+    }
+    double cellVolume(int cell) const
+    {
+        return grid_.geomVector<0>().get(cell).volume();
+    }
+    bool cellHasCorners(int cell) const
+    {
+        return grid_.geomVector<0>().get(cell).hasCorners();
+    }
+    const PointType& faceCenter(int face) const
+    {
+        return grid_.geomVector<1>().get(face).center();
+    }
+    double faceArea(int face) const
+    {
+        return grid_.geomVector<1>().get(face).volume();
+    }
+    enum face_tag faceTag(int face) const
+    {
+        return grid_.face_tag_.get(face);
+    }
+    const PointType& faceNormal(int face) const
+    {
+        return grid_.face_normals_.get(face);
+    }
+    const PointType& pointPosition(int point) const
+    {
+        return grid_.geomVector<3>().get(point).center();
+    }
+    const int* globalCell() const
+    {
+        return grid_.global_cell_.data();
+    }
+    const std::array<int, 3>& logicalCartesianSize() const
+    {
+        return grid_.logical_cartesian_size_;
+    }
+    bool hasUniqueBoundaryIds() const
+    {
+        return !grid_.unique_boundary_ids_.empty();
+    }
+    int uniqueBoundaryId(int face) const
+    {
+        return grid_.unique_boundary_ids_.get(face);
+    }
 
-void CpGridData::distributeGlobalGrid(const CpGrid& grid,
-                                      const CpGridData& view_data,
-                                      const std::vector<int>& cell_part,
-                                      int overlap_layers)
-{
-#if HAVE_MPI
-    Dune::CollectiveCommunication<Dune::MPIHelper::MPICommunicator>& ccobj=ccobj_;
-    int my_rank=ccobj.rank();
-#if 0
-    int size=ccobj.size();
-    typedef std::vector<int>::const_iterator Iterator;
-    for(Iterator i=cell_part.begin(); i!= cell_part.end(); ++i)
-        if(*i>=size)
-            OPM_THROW(std::runtime_error, "rank for cell is too big");
-#endif // #ifdef DEBUG
-    // vector with the set of ranks that
-    std::vector<std::set<int> > overlap;
+private:
+    const CpGridData& grid_;
+};
 
-    overlap.resize(cell_part.size());
-    addOverlapLayer(grid, cell_part, overlap, my_rank, false, overlap_layers);
+void CpGridData::setupCellIndexSet(const std::vector<int>& cell_part,
+                                   const std::vector<std::set<int> >& overlap)
+{
+    int my_rank=ccobj_.rank();
     // count number of cells
     struct CellCounter
     {
@@ -597,6 +837,7 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
     cell_counter.global2local.reserve(cell_part.size());
     cell_counter.indexset=&cell_indexset_;
     // set up the index set.
+    PhaseTimings::Scope index_set_timer(phase_timings_, GridPhase::IndexSet);
     cell_counter.indexset->beginResize();
     typedef std::vector<std::set<int> >::const_iterator OIterator;
     std::vector<int>::const_iterator ci=cell_part.begin();
@@ -610,7 +851,9 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
             cell_counter(i-begin, *ci);
     }
     cell_counter.indexset->endResize();
+    index_set_timer.stop();
     // setup the remote indices.
+    PhaseTimings::Scope remote_indices_timer(phase_timings_, GridPhase::RemoteIndices);
     typedef RemoteIndexListModifier<RemoteIndices::ParallelIndexSet, RemoteIndices::Allocator,
                                     false> Modifier;
     typedef RemoteIndices::RemoteIndex RemoteIndex;
@@ -659,35 +902,34 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
         // Force update of the sync counter in the remote indices.
         cell_remote_indices_.getModifier<false,false>(0);
     }
+    remote_indices_timer.stop();
+}
 
+template<class GlobalGrid>
+void CpGridData::extractLocalGrid(const GlobalGrid& global_grid)
+{
     // We can identify existing cells with the help of the index set.
+    // The extraction of the geometries is included in the topology phase.
+    PhaseTimings::Scope topology_timer(phase_timings_, GridPhase::Topology);
     // Now we need to compute the existing faces and points. Either exist
     // if they are reachable from an existing cell.
     // We use std::numeric_limits<int>::max() to indicate non-existent entities.
-    std::vector<int> face_indicator(view_data.geometry_.geomVector<1>().size(),
+    std::vector<int> face_indicator(global_grid.numFaces(),
                                     std::numeric_limits<int>::max());
-    std::vector<int> point_indicator(view_data.geometry_.geomVector<3>().size(),
+    std::vector<int> point_indicator(global_grid.numPoints(),
                                      std::numeric_limits<int>::max());
     for(ParallelIndexSet::iterator i=cell_indexset_.begin(), end=cell_indexset_.end();
             i!=end; ++i)
     {
-        typedef boost::iterator_range<const EntityRep<1>*>::iterator RowIter;
-        int row_index=i->global();
-        // Somehow g++-4.4 does not find functions of father even if we
-        // change inheritance of OrientedEntityTable to public.
-        // Therfore we use an ugly cast to base class here.
-        const Opm::SparseTable<EntityRep<1> >& c2f=view_data.cell_to_face_;
-        for(RowIter f=c2f[row_index].begin(), fend=c2f[row_index].end();
-            f!=fend; ++f)
+        for(const auto& f : global_grid.cellFaces(i->global()))
         {
-            int findex=f->index();
+            int findex=f.index();
             --face_indicator[findex];
             // points reachable from a cell exist, too.
-            for(auto p=view_data.face_to_point_[findex].begin(),
-                    pend=view_data.face_to_point_[findex].end(); p!=pend; ++p)
+            for(int p : global_grid.facePoints(findex))
             {
-                assert(*p >= 0);
-                --point_indicator[*p];
+                assert(p >= 0);
+                --point_indicator[p];
             }
         }
     }
@@ -698,41 +940,25 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
     std::for_each(point_indicator.begin(), point_indicator.end(), AssignAndIncrement());
 
     std::vector<int> map2GlobalFaceId;
-    int noExistingFaces = setupAndCountGlobalIds<1>(face_indicator, map2GlobalFaceId,
-                                                    *view_data.local_id_set_);
+    int noExistingFaces = setupAndCountGlobalIds(face_indicator, map2GlobalFaceId,
+                                                 [&](int f) { return global_grid.faceId(f); });
     std::vector<int> map2GlobalPointId;
-    int noExistingPoints = setupAndCountGlobalIds<3>(point_indicator, map2GlobalPointId,
-                                                     *view_data.local_id_set_);
+    int noExistingPoints = setupAndCountGlobalIds(point_indicator, map2GlobalPointId,
+                                                  [&](int p) { return global_grid.pointId(p); });
     std::vector<int> map2GlobalCellId(cell_indexset_.size());
     for(ParallelIndexSet::const_iterator i=cell_indexset_.begin(), end=cell_indexset_.end();
         i!=end; ++i)
     {
-        map2GlobalCellId[i->local()]=view_data.local_id_set_->id(EntityRep<0>(i->global(), true));
+        map2GlobalCellId[i->local()]=global_grid.cellId(i->global());
     }
 
     global_id_set_->swap(map2GlobalCellId, map2GlobalFaceId, map2GlobalPointId);
-    // Set up the new topology arrays
-    EntityVariable<cpgrid::Geometry<3, 3>, 0> cell_geom;
-    std::vector<cpgrid::Geometry<3, 3> > tmp_cell_geom(cell_indexset_.size());
-    auto global_cell_geom=view_data.geomVector<0>();
-    global_cell_.resize(cell_indexset_.size());
-
-    // Copy the existing cells.
-    for(auto i=cell_indexset_.begin(), end=cell_indexset_.end(); i!=end; ++i)
-    {
-        tmp_cell_geom[i->local()]=static_cast<std::vector<cpgrid::Geometry<3, 3> >&>(global_cell_geom)[i->global()];
-        global_cell_[i->local()]=view_data.global_cell_[i->global()];
-    }
-    static_cast<std::vector<cpgrid::Geometry<3, 3> >&>(cell_geom).swap(tmp_cell_geom);
 
     // count the existing faces, renumber, and allocate space.
     EntityVariable<cpgrid::Geometry<2, 3>, 1> face_geom;
     std::vector<cpgrid::Geometry<2, 3> > tmp_face_geom(noExistingFaces);
     std::vector<enum face_tag> tmp_face_tag(noExistingFaces);
     std::vector<PointType> tmp_face_normals(noExistingFaces);
-    const std::vector<cpgrid::Geometry<2, 3> >& global_face_geom=view_data.geomVector<1>();
-    const std::vector<enum face_tag>& global_face_tag=view_data.face_tag_;
-    const std::vector<PointType>& global_face_normals=view_data.face_normals_;
 
     // Now copy the face geometries that do exist.
     auto fg = tmp_face_geom.begin();
@@ -743,9 +969,10 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
     {
         if(*fi<std::numeric_limits<int>::max())
         {
-            *fg=global_face_geom[fi-begin];
-            *ft=global_face_tag[fi-begin];
-            *fn=global_face_normals[fi-begin];
+            const int face = fi-begin;
+            *fg=cpgrid::Geometry<2, 3>(global_grid.faceCenter(face), global_grid.faceArea(face));
+            *ft=global_grid.faceTag(face);
+            *fn=global_grid.faceNormal(face);
             ++fg; ++ft; ++fn;
         }
     }
@@ -756,7 +983,6 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
     // Count the existing points and allocate space
     std::vector<cpgrid::Geometry<0, 3> > tmp_point_geom(noExistingPoints);
     EntityVariable<cpgrid::Geometry<0, 3>, 3> point_geom;
-    const std::vector<cpgrid::Geometry<0, 3> >& global_point_geom=view_data.geomVector<3>();
 
     // Now copy the point geometries that do exist.
     auto pt = tmp_point_geom.begin();
@@ -765,25 +991,20 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
     {
         if(*pi<std::numeric_limits<int>::max())
         {
-            *pt=global_point_geom[pi-begin];
+            *pt=cpgrid::Geometry<0, 3>(global_grid.pointPosition(pi-begin));
             ++pt;
         }
     }
     // swap the underlying vectors to get data into point_geom
     static_cast<std::vector<cpgrid::Geometry<0, 3> >&>(point_geom).swap(tmp_point_geom);
 
-    // Copy the vectors to geometry. There is no other way currently.
-    geometry_=cpgrid::DefaultGeometryPolicy(cell_geom, face_geom,
-                                            point_geom);
-
     // Create the topology information. This is stored in sparse matrix like data structures.
     // First conunt the size of the nonzeros of the cell_to_face data.
     int data_size=0;
     for(auto i=cell_indexset_.begin(), end=cell_indexset_.end();
         i!=end; ++i)
     {
-        const Opm::SparseTable<EntityRep<1> >& c2f=view_data.cell_to_face_;
-        data_size+=c2f.rowSize(i->global());
+        data_size+=global_grid.cellFaces(i->global()).size();
     }
 
     //- cell_to_face_ : extract owner/overlap rows from cell_to_face_
@@ -795,32 +1016,53 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
     for(auto i=cell_indexset_.begin(), end=cell_indexset_.end();
         i!=end; ++i)
     {
-        typedef boost::iterator_range<const EntityRep<1>*>::const_iterator RowIter;
-        const Opm::SparseTable<EntityRep<1> >& c2f=view_data.cell_to_face_;
-        auto row=c2f[i->global()];
+        auto row=global_grid.cellFaces(i->global());
         // create the new row, i.e. copy orientation and use new face indicator.
         std::vector<EntityRep<1> > new_row(row.size());
         std::vector<EntityRep<1> >::iterator  nface=new_row.begin();
-        for(RowIter face=row.begin(), fend=row.end(); face!=fend; ++face, ++nface)
+        for(auto face=row.begin(), fend=row.end(); face!=fend; ++face, ++nface)
             nface->setValue(face_indicator[face->index()], face->orientation());
         // Append the new row to the matrix
         cell_to_face_.appendRow(new_row.begin(), new_row.end());
         for(int j=0; j<8; ++j)
-            cell_to_point_[i->local()][j]=point_indicator[view_data.cell_to_point_[i->global()][j]];
+            cell_to_point_[i->local()][j]=point_indicator[global_grid.cellPoints(i->global())[j]];
     }
 
+    // Copy the existing cells. Their corners are the point geometries of
+    // this view, hence it does not depend on the global grid.
+    EntityVariable<cpgrid::Geometry<3, 3>, 0> cell_geom;
+    std::vector<cpgrid::Geometry<3, 3> > tmp_cell_geom(cell_indexset_.size());
+    const cpgrid::Geometry<0, 3>* corners = noExistingPoints ? &point_geom.get(0) : nullptr;
+    global_cell_.resize(cell_indexset_.size());
+    for(auto i=cell_indexset_.begin(), end=cell_indexset_.end(); i!=end; ++i)
+    {
+        const int cell = i->global();
+        if(global_grid.cellHasCorners(cell))
+            tmp_cell_geom[i->local()]=cpgrid::Geometry<3, 3>(global_grid.cellCenter(cell),
+                                                             global_grid.cellVolume(cell),
+                                                             corners,
+                                                             cell_to_point_[i->local()].data());
+        else
+            tmp_cell_geom[i->local()]=cpgrid::Geometry<3, 3>(global_grid.cellCenter(cell),
+                                                             global_grid.cellVolume(cell));
+        global_cell_[i->local()]=global_grid.globalCell()[cell];
+    }
+    static_cast<std::vector<cpgrid::Geometry<3, 3> >&>(cell_geom).swap(tmp_cell_geom);
+
+    // Move the vectors to geometry, which keeps the corners valid.
+    geometry_=cpgrid::DefaultGeometryPolicy(std::move(cell_geom), std::move(face_geom),
+                                            std::move(point_geom));
+
     // Calculate the number of nonzeros needed for the face_to_cell sparse matrix
-    // To speed things up, we only use an upper limit here.
     data_size=0;
-    const Opm::SparseTable<EntityRep<0> >& f2c=view_data.face_to_cell_;
-    for(auto f=face_indicator.begin(), fend=face_indicator.end(); f!=fend; ++f)
+    for(auto begin=face_indicator.begin(), f=begin, fend=face_indicator.end(); f!=fend; ++f)
         if(*f<std::numeric_limits<int>::max())
-            data_size += f2c.rowSize(*f);
+            data_size += global_grid.faceCells(f-begin).size();
 
-    face_to_cell_.reserve(f2c.size(), data_size);
+    face_to_cell_.reserve(global_grid.numFaces(), data_size);
 
     //- face_to cell_ : extract rows that connect to an existent cell
-    std::vector<int> cell_indicator(view_data.cell_to_face_.size(),
+    std::vector<int> cell_indicator(global_grid.numCells(),
                                     std::numeric_limits<int>::max());
     for(auto i=cell_indexset_.begin(), end=cell_indexset_.end(); i!=end; ++i)
         cell_indicator[i->global()]=i->local();
@@ -831,7 +1073,7 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
         {
             // face does exist
             std::vector<EntityRep<0> > new_row;
-            auto old_row = f2c[f-begin];
+            auto old_row = global_grid.faceCells(f-begin);
             new_row.reserve(old_row.size());
             // push back connected existent cells.
             // for those cells we use the new cell_indicator and copy the
@@ -849,14 +1091,15 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
             face_to_cell_.appendRow(new_row.begin(), new_row.end());
         }
     }
+    computeFaceCells();
 
     // Compute the number of non zeros of the face_to_point matrix.
     data_size=0;
-    for(auto f=face_indicator.begin(), fend=face_indicator.end(); f!=fend; ++f)
+    for(auto begin=face_indicator.begin(), f=begin, fend=face_indicator.end(); f!=fend; ++f)
         if(*f<std::numeric_limits<int>::max())
-            data_size += view_data.face_to_point_.rowSize(*f);
+            data_size += global_grid.facePoints(f-begin).size();
 
-    face_to_point_.reserve(view_data.face_to_point_.size(), data_size);
+    face_to_point_.reserve(global_grid.numFaces(), data_size);
 
     //- face_to_point__ : extract row associated with existing faces_
     for(auto begin=face_indicator.begin(), f=begin, fend=face_indicator.end(); f!=fend; ++f)
@@ -865,7 +1108,7 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
         {
             // face does exist
             std::vector<int> new_row;
-            auto old_row = view_data.face_to_point_[f-begin];
+            auto old_row = global_grid.facePoints(f-begin);
             new_row.reserve(old_row.size());
             for(auto point = old_row.begin(), pend=old_row.end(); point!=pend; ++point)
             {
@@ -876,19 +1119,18 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
         }
     }
 
-    logical_cartesian_size_=view_data.logical_cartesian_size_;
+    logical_cartesian_size_=global_grid.logicalCartesianSize();
 
     // - unique_boundary_ids_ : extract the ones that correspond existent faces
-    if(view_data.unique_boundary_ids_.size())
+    if(global_grid.hasUniqueBoundaryIds())
     {
         // Unique boundary ids are inherited from the global grid.
-        auto id=view_data.unique_boundary_ids_.begin();
-        unique_boundary_ids_.reserve(view_data.face_to_cell_.size());
-        for(auto f=face_indicator.begin(), fend=face_indicator.end(); f!=fend; ++f, ++id)
+        unique_boundary_ids_.reserve(global_grid.numFaces());
+        for(auto begin=face_indicator.begin(), f=begin, fend=face_indicator.end(); f!=fend; ++f)
         {
             if(*f<std::numeric_limits<int>::max())
             {
-                unique_boundary_ids_.push_back(*id);
+                unique_boundary_ids_.push_back(global_grid.uniqueBoundaryId(f-begin));
             }
         }
     }
@@ -927,8 +1169,59 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
                 partition_type_indicator_->point_indicator_[*p]=new_type;
         }
     }
+    computePartitionEntities();
+    topology_timer.stop();
+}
+#endif // #if HAVE_MPI
+
+void CpGridData::distributeGlobalGrid(const CpGrid& grid,
+                                      const CpGridData& view_data,
+                                      const std::vector<int>& cell_part,
+                                      int overlap_layers,
+                                      const std::vector<NonNeighbourConnection>& nncs)
+{
+#if HAVE_MPI
+    int my_rank=ccobj_.rank();
+    // vector with the set of ranks that
+    std::vector<std::set<int> > overlap;
+
+    overlap.resize(cell_part.size());
+    PhaseTimings::Scope overlap_timer(phase_timings_, GridPhase::Overlap);
+    addOverlapLayer(grid, cell_part, overlap, my_rank, overlap_layers, true, &nncs);
+    overlap_timer.stop();
+
+    setupCellIndexSet(cell_part, overlap);
+    extractLocalGrid(GlobalGridView(view_data));
+    computeInterfaces();
+#else // #if HAVE_MPI
+    static_cast<void>(grid);
+    static_cast<void>(view_data);
+    static_cast<void>(cell_part);
+    static_cast<void>(overlap_layers);
+    static_cast<void>(nncs);
+#endif
+}
+
+#if HAVE_MPI
+void CpGridData::distributeGlobalGrid(const NodeSharedGlobalGrid& global_grid,
+                                      const std::vector<int>& cell_part,
+                                      int overlap_layers,
+                                      const std::vector<NonNeighbourConnection>& nncs)
+{
+    std::vector<std::set<int> > overlap;
+    PhaseTimings::Scope overlap_timer(phase_timings_, GridPhase::Overlap);
+    addOverlapLayer(global_grid, cell_part, overlap, ccobj_.rank(), overlap_layers, true, &nncs);
+    overlap_timer.stop();
 
+    setupCellIndexSet(cell_part, overlap);
+    extractLocalGrid(global_grid);
+    computeInterfaces();
+}
+
+void CpGridData::computeInterfaces()
+{
     // Compute the interface information for cells
+    PhaseTimings::Scope interfaces_timer(phase_timings_, GridPhase::Interfaces);
     std::get<InteriorBorder_All_Interface>(cell_interfaces_)
         .build(cell_remote_indices_, EnumItem<AttributeSet, AttributeSet::owner>(),
                AllSet<AttributeSet>());
@@ -977,7 +1270,7 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
                      face_interfaces_);
     std::vector<std::map<int,char> >().swap(face_attributes);
     */
-    std::vector<std::map<int,char> > point_attributes(noExistingPoints);
+    std::vector<std::map<int,char> > point_attributes(geometry_.geomVector<3>().size());
     AttributeDataHandle<std::vector<std::array<int,8> > >
         point_handle(ccobj_.rank(), *partition_type_indicator_,
                      point_attributes, cell_to_point_, *this);
@@ -988,13 +1281,8 @@ void CpGridData::distributeGlobalGrid(const CpGrid& grid,
     }
     createInterfaces(point_attributes, partition_type_indicator_->point_indicator_.begin(),
                      point_interfaces_);
-#else // #if HAVE_MPI
-    static_cast<void>(grid);
-    static_cast<void>(view_data);
-    static_cast<void>(cell_part);
-    static_cast<void>(overlap_layers);
-#endif
 }
+#endif
 
 } // end namespace cpgrid
 } // end namespace Dune
@@ -67,6 +67,7 @@
 
 
 #include <array>
+#include <set>
 #include <tuple>
 #include <algorithm>
 
@@ -78,6 +79,13 @@
 
 #include "Entity2IndexDataHandle.hpp"
 #include "GlobalIdMapping.hpp"
+#include "MemoryUsage.hpp"
+#include "NonNeighbourConnection.hpp"
+#include "PhaseTimings.hpp"
+
+struct grid_file;
+struct grid_file_section;
+struct UnstructuredGrid;
 
 namespace Dune
 {
@@ -89,7 +97,9 @@ namespace cpgrid
 class IndexSet;
 class IdSet;
 class GlobalIdSet;
+class NodeSharedGlobalGrid;
 class PartitionTypeIndicator;
+class UnstructuredGridView;
 template<int,int> class Geometry;
 template<int> class Entity;
 template<int> class EntityRep;
@@ -163,6 +173,43 @@ public:
     /// found in <grid_prefix>-topo.dat etc.
     void writeSintefLegacyFormat(const std::string& grid_prefix) const;
 
+    /// Read the binary grid format written by writeBinaryFormat().
+    /// The arrays are taken from a memory mapping of the file.
+    /// \param filename the name of the file to read.
+    void readBinaryFormat(const std::string& filename);
+
+    /// Write the binary grid format, see opm/grid/grid_file.h.
+    /// \param filename the name of the file to write.
+    void writeBinaryFormat(const std::string& filename) const;
+
+    /// \brief Describe this view as an UnstructuredGrid, see UnstructuredGridView.
+    void fillUnstructuredGridView(UnstructuredGridView& view) const;
+
+    /// \brief Build this view from an UnstructuredGrid of a corner-point grid.
+    ///
+    /// The topology and geometry are copied, but neither the corner-point
+    /// processing nor the geometry computations are repeated.
+    /// \param grid A grid with cell face tags, e.g. of create_grid_cornerpoint().
+    void processUnstructuredGrid(const UnstructuredGrid& grid);
+
+    /// \brief Write the distributed view of this process to a checkpoint.
+    ///
+    /// Besides the topology and geometry of writeBinaryFormat() the file
+    /// holds the cell index set, the remote indices, the global ids and
+    /// the partition types of cells and points.
+    /// \param filename the name of the file to write.
+    void writeCheckpoint(const std::string& filename) const;
+
+    /// \brief Restore a distributed view written by writeCheckpoint().
+    ///
+    /// Neither the global grid nor the partitioning or overlap are needed.
+    /// Only the communication interfaces are set up anew, which exchanges
+    /// messages with the neighbouring processes.
+    /// \param filename the name of the file of this process.
+    /// \throw std::runtime_error if the file cannot be read or was written
+    ///        by another rank or for another number of processes.
+    void readCheckpoint(const std::string& filename);
+
     /// Read the Eclipse grid format ('grdecl').
     /// \param filename the name of the file to read.
     /// \param periodic_extension if true, the grid will be (possibly) refined, so that
@@ -260,13 +307,57 @@ public:
         return logical_cartesian_size_;
     }
 
+    /// \brief Renumber cells, faces and points to improve memory locality.
+    ///
+    /// Only possible for a grid that is not distributed.
+    /// \see CpGrid::reorderForLocality()
+    void reorderForLocality();
+
+    /// \brief Get the indices the entities had before reorderForLocality().
+    /// \param codim The codimension of the entities (0, 1, or 3).
+    /// \return The original index of each entity. Empty if the grid
+    ///         has not been reordered.
+    const std::vector<int>& originalIndices(int codim) const;
+
+    /// \brief Estimate the memory used by the components of this view.
+    /// \see CpGrid::memoryUsage()
+    MemoryUsage memoryUsage() const;
+
     /// \brief Redistribute a global grid.
     ///
     /// The whole grid must be available on all processors.
+    /// \param nncs Non-neighbour connections with compressed cell indices,
+    ///             whose cells are added to the overlap like face neighbours.
     void distributeGlobalGrid(const CpGrid& grid,
                               const CpGridData& view_data,
                               const std::vector<int>& cell_part,
-                              int overlap_layers);
+                              int overlap_layers,
+                              const std::vector<NonNeighbourConnection>& nncs
+                              = std::vector<NonNeighbourConnection>());
+
+#if HAVE_MPI
+    /// \brief Redistribute a global grid stored once per node.
+    ///
+    /// Like the overload above, but the global grid is read from the shared
+    /// memory of the node and need not be held by this process.
+    void distributeGlobalGrid(const NodeSharedGlobalGrid& global_grid,
+                              const std::vector<int>& cell_part,
+                              int overlap_layers,
+                              const std::vector<NonNeighbourConnection>& nncs
+                              = std::vector<NonNeighbourConnection>());
+#endif
+
+    /// \brief Get the precomputed entities visited by a partition iterator.
+    ///
+    /// The lists exist for cells and points of a distributed grid and for the
+    /// partition iterator types that select a proper subset of the entities
+    /// (Interior_Partition, InteriorBorder_Partition, and Overlap_Partition).
+    /// \param codim The codimension of the entities.
+    /// \param pitype The type of the partition iterator.
+    /// \return The sorted indices of the entities to visit, or nullptr if no
+    ///         list is available and the partition type has to be checked for
+    ///         each entity.
+    const std::vector<int>* partitionEntities(int codim, PartitionIteratorType pitype) const;
 
     /// \brief communicate objects for all codims on a given level
     /// \param data The data handle describing the data. Has to adhere to the
@@ -278,6 +369,47 @@ public:
 
 private:
 
+    /// \brief Compute the entity lists used by the partition iterators.
+    ///
+    /// Has to be called once the partition types of cells and points are known.
+    void computePartitionEntities();
+
+    /// \brief Compute face_cells_ from face_to_cell_.
+    void computeFaceCells();
+
+    /// \brief Read the topology and geometry of the binary grid format.
+    void readBinaryFormat(const grid_file* file, const std::string& filename);
+
+    /// \brief Write the binary grid format with additional sections.
+    void writeBinaryFormat(const std::string& filename,
+                           const std::vector<grid_file_section>& extra_sections) const;
+
+#if HAVE_MPI
+    /// \brief Set up the cell and point communication interfaces.
+    ///
+    /// Needs the cell index set, the remote indices and the partition
+    /// types of a distributed view.
+    void computeInterfaces();
+
+    /// \brief Set up the index set and the remote indices of the cells.
+    /// \param cell_part The owner of each cell of the global grid.
+    /// \param overlap The processes that each cell of the global grid is
+    ///        an overlap cell of.
+    void setupCellIndexSet(const std::vector<int>& cell_part,
+                           const std::vector<std::set<int> >& overlap);
+
+    /// \brief Copy the cells of the index set, and their faces and points,
+    ///        from the global grid.
+    /// \tparam GlobalGrid Gives access to the global grid like
+    ///         NodeSharedGlobalGrid, see also GlobalGridView.
+    template<class GlobalGrid>
+    void extractLocalGrid(const GlobalGrid& global_grid);
+
+    /// \brief Access to the global grid of a CpGridData with the
+    ///        interface of NodeSharedGlobalGrid.
+    class GlobalGridView;
+#endif
+
 #if HAVE_MPI
 
     /// \brief Gather data on a global grid representation.
@@ -359,6 +491,15 @@ private:
      * marked with index std::numeric_limits<int>::max()
      */
     cpgrid::OrientedEntityTable<1, 0> face_to_cell_;
+    /**
+     * @brief The cells attached to each face as a flat array.
+     *
+     * The cells of face f are stored at positions 2*f and 2*f+1. The first
+     * is the cell the face normal points out of, the second the one it points
+     * into. Cells that are missing because of the domain boundary or because
+     * they are not present on this process are marked with -1.
+     */
+    std::vector<int>                  face_cells_;
     /** @brief Container for the lookup of the points for each face. */
     Opm::SparseTable<int>             face_to_point_;
     /** @brief Vector that contains an arrays of the points of each cell*/
@@ -385,8 +526,6 @@ private:
     typedef FieldVector<double, 3> PointType;
     /** @brief The face normals of the grid. */
     cpgrid::SignedEntityVariable<PointType, 1> face_normals_;
-    /** @brief All corners of the grid. */
-    std::vector<PointType> allcorners_; // Yes, this is already stored in the point geometries. \TODO Improve by removing it.
     /** @brief The boundary ids. */
     cpgrid::EntityVariable<int, 1> unique_boundary_ids_;
     /** @brief The index set of the grid (level). */
@@ -397,6 +536,23 @@ private:
     GlobalIdSet* global_id_set_;
     /** @brief The indicator of the partition type of the entities */
     PartitionTypeIndicator* partition_type_indicator_;
+    /**
+     * @brief The entities visited by the partition iterators.
+     *
+     * Entry [0] holds the cells and entry [1] the points. Each of them
+     * is indexed by the PartitionIteratorType (Interior_Partition,
+     * InteriorBorder_Partition, Overlap_Partition) and contains the sorted
+     * entity indices. Empty if the grid is not distributed.
+     */
+    std::array<std::array<std::vector<int>, 3>, 2> partition_entities_;
+    /**
+     * @brief The indices the entities had before reorderForLocality().
+     *
+     * Entry [0] holds the cells, [1] the faces and [2] the points.
+     */
+    std::array<std::vector<int>, 3> original_index_;
+    /// \brief The time spent in the phases of constructing this view.
+    PhaseTimings phase_timings_;
 
     /// \brief The type of the collective communication.
     typedef MPIHelper::MPICommunicator MPICommunicator;
@@ -466,6 +622,7 @@ private:
     template<int> friend class EntityRep;
     template<int> friend class EntityPointer;
     friend class Intersection;
+    friend class NodeSharedGlobalGrid;
     friend class PartitionTypeIndicator;
 };
 
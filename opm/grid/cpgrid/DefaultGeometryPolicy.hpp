@@ -36,6 +36,7 @@ along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPM_DEFAULTGEOMETRYPOLICY_HEADER
 #define OPM_DEFAULTGEOMETRYPOLICY_HEADER
 
+#include <utility>
 #include "Geometry.hpp"
 #include "EntityRep.hpp"
 
@@ -64,6 +65,21 @@ namespace Dune
             {
             }
 
+            /// @brief Construct by taking over the given geometries.
+            ///
+            /// Cell geometries refer to the point geometries for their
+            /// corners. Moving keeps those references valid, copying does not.
+            /// @param cell_geom geometries of the cells
+            /// @param face_geom geometries of the faces
+            /// @param point_geom geometries of the points
+            DefaultGeometryPolicy(EntityVariable<cpgrid::Geometry<3, 3>, 0>&& cell_geom,
+                                  EntityVariable<cpgrid::Geometry<2, 3>, 1>&& face_geom,
+                                  EntityVariable<cpgrid::Geometry<0, 3>, 3>&& point_geom)
+                : cell_geom_(std::move(cell_geom)), face_geom_(std::move(face_geom)),
+                  point_geom_(std::move(point_geom))
+            {
+            }
+
             /// @brief
             /// @todo Doc me!
             /// @tparam
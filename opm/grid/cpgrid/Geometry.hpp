@@ -114,13 +114,13 @@ namespace Dune
             ///        corners.
             /// @param pos the centroid of the entity
             /// @param vol the volume(area) of the entity
-            /// @param allcorners array of all corner positions in the grid
+            /// @param allcorners array of all vertex geometries in the grid
             /// @param corner_indices array of 8 indices into allcorners array. The
             ///                       indices must be given in lexicographical order
             ///                       by (kji), i.e. i running fastest.
             Geometry(const GlobalCoordinate& pos,
                      ctype vol,
-                     const GlobalCoordinate* allcorners,
+                     const Geometry<0, cdim>* allcorners,
                      const int* corner_indices)
                 : pos_(pos), vol_(vol), allcorners_(allcorners), cor_idx_(corner_indices)
             {
@@ -138,7 +138,7 @@ namespace Dune
             /// @param vol the volume(area) of the entity
             Geometry(const GlobalCoordinate& pos,
                      ctype vol)
-                : pos_(pos), vol_(vol)
+                : pos_(pos), vol_(vol), allcorners_(0), cor_idx_(0)
             {
             }
 
@@ -243,7 +243,14 @@ namespace Dune
             GlobalCoordinate corner(int cor) const
             {
                 assert(allcorners_ && cor_idx_);
-                return allcorners_[cor_idx_[cor]];
+                return allcorners_[cor_idx_[cor]].center();
+            }
+
+            /// Whether the geometry was constructed with corners,
+            /// i.e. whether corner(), global() etc. may be called.
+            bool hasCorners() const
+            {
+                return allcorners_ != 0;
             }
 
             /// Cell volume.
@@ -315,7 +322,7 @@ namespace Dune
         private:
             GlobalCoordinate pos_;
             double vol_;
-            const GlobalCoordinate* allcorners_; // For dimension 3 only
+            const Geometry<0, cdim>* allcorners_; // For dimension 3 only
             const int* cor_idx_;               // For dimension 3 only
         };
 
@@ -359,7 +366,7 @@ namespace Dune
             /// @param vol the volume(area) of the entity
             Geometry(const GlobalCoordinate& pos,
                      ctype vol)
-                : pos_(pos), vol_(vol)
+                : pos_(pos), vol_(vol), allcorners_(0), cor_idx_(0)
             {
             }
 
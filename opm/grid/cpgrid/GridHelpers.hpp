@@ -42,23 +42,25 @@ class FaceCellsProxy
 {
 public:
     /// \brief Constructor.
-    /// \param grid The grid whose face to cell mapping we represent.
+    /// \param face_cells The flat face to cell array of the grid (see CpGrid::faceCells()).
     /// \param cell_index The index of the cell we repesent.
-    FaceCellsProxy(const Dune::CpGrid* grid, int cell_index)
-        : grid_(grid), cell_index_(cell_index)
+    FaceCellsProxy(const int* face_cells, int cell_index)
+        : face_cells_(face_cells + 2*cell_index)
     {}
     /// \brief Get the index of the cell associated with a local_index.
     int operator[](int local_index)
     {
-        return grid_->faceCell(cell_index_, local_index);
+        return face_cells_[local_index];
     }
 private:
-    const Dune::CpGrid* grid_;
-    int cell_index_;
+    const int* face_cells_;
 };
 
 /// \brief A class representing the face to cells mapping similar to the
 /// way done in UnstructuredGrid.
+///
+/// This is a view of the flat array returned by CpGrid::faceCells() and
+/// becomes invalid if the grid switches between its global and distributed view.
 class FaceCellsContainerProxy
 {
 public:
@@ -67,13 +69,13 @@ public:
     /// \brief Constructor.
     /// \param grid The grid whose information we represent.
     explicit FaceCellsContainerProxy(const Dune::CpGrid* grid)
-        : grid_(grid)
+        : face_cells_(grid->faceCells())
     {}
     /// \brief Get the mapping for a cell.
     /// \param cell_index The index of the cell.
     FaceCellsProxy operator[](int cell_index) const
     {
-        return FaceCellsProxy(grid_, cell_index);
+        return FaceCellsProxy(face_cells_, cell_index);
     }
     /// \brief Get a face associated with a cell.
     /// \param cell_index The index of the cell.
@@ -82,10 +84,10 @@ public:
     /// a boundary.
     int operator()(int cell_index, int local_index) const
     {
-        return grid_->faceCell(cell_index, local_index);
+        return face_cells_[2*cell_index + local_index];
     }
 private:
-    const Dune::CpGrid* grid_;
+    const int* face_cells_;
 };
 
 
@@ -36,6 +36,8 @@ along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPM_ITERATORS_HEADER
 #define OPM_ITERATORS_HEADER
 
+#include <algorithm>
+#include <vector>
 #include <dune/grid/common/gridenums.hh>
 #include "PartitionIteratorRule.hpp"
 #include <opm/grid/utility/ErrorMacros.hpp>
@@ -68,6 +70,12 @@ namespace Dune
             /// then this must change, too.
             Iterator& operator++()
             {
+                if(entities_)
+                {
+                    ++position_;
+                    setToPosition();
+                    return *this;
+                }
                 EntityRep<cd>::increment();
                 if(rule_.fullSet || rule_.emptySet)
                     return *this;
@@ -76,9 +84,24 @@ namespace Dune
                 return *this;
             }
         private:
+            /// \brief Move to the entity stored at position_ in entities_.
+            ///
+            /// If position_ is past the last entry, this becomes the end iterator.
+            void setToPosition()
+            {
+                EntityRep<cd>::setValue(position_<entities_->size() ?
+                                        (*entities_)[position_] : noEntities_,
+                                        true);
+            }
             /// \brief The number of Entities with codim cd.
             int noEntities_;
             PartitionIteratorRule<pitype> rule_;
+            /// \brief The precomputed entities of the partition, if available.
+            ///
+            /// If nullptr, the partition rule is evaluated for each entity.
+            const std::vector<int>* entities_;
+            /// \brief The position of the current entity in entities_.
+            std::size_t position_;
         };
 
 
@@ -151,11 +174,20 @@ Iterator<cd, pitype>::Iterator(const CpGridData& grid, int index, bool orientati
                         // If the partition is empty, goto to end iterator!
                         EntityRep<cd>(PartitionIteratorRule<pitype>::emptySet?grid.size(cd):index,
                                       orientation)),
-      noEntities_(grid.size(cd))
+      noEntities_(grid.size(cd)), entities_(nullptr), position_(0)
 {
     if(rule_.fullSet || rule_.emptySet)
         return;
 
+    entities_ = grid.partitionEntities(cd, pitype);
+    if(entities_)
+    {
+        position_ = std::lower_bound(entities_->begin(), entities_->end(), this->index())
+            - entities_->begin();
+        setToPosition();
+        return;
+    }
+
     while(this->index()<noEntities_ && rule_.isInvalid(*this))
         EntityRep<cd>::increment();
 }
@@ -0,0 +1,214 @@
+//===========================================================================
+//
+// File: MemoryUsage.hpp
+//
+// Created: Mon Oct 19 2026
+//
+//===========================================================================
+
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CPGRID_MEMORYUSAGE_HEADER
+#define OPM_CPGRID_MEMORYUSAGE_HEADER
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief The memory used by the components of one view of a CpGrid in bytes.
+///
+/// The numbers are estimates computed from the sizes and capacities of
+/// the containers, not measurements of the heap. Overheads of the allocator
+/// are not included.
+struct MemoryUsage
+{
+    /// \brief Cell to face, face to cell, face to point and cell to point tables.
+    std::size_t topology = 0;
+    /// \brief Cell, face and point geometries, face normals and the
+    ///        geometry arrays.
+    std::size_t geometry = 0;
+    /// \brief Global cell indices, face tags, boundary ids, partition types
+    ///        and the other per entity data.
+    std::size_t entity_data = 0;
+    /// \brief The zcorn values retained from the grid processing.
+    std::size_t zcorn = 0;
+    /// \brief Index sets, local id set and the parallel index set of the cells.
+    std::size_t index_sets = 0;
+    /// \brief Remote index information of the cells.
+    std::size_t remote_indices = 0;
+    /// \brief Communication interfaces of cells and points.
+    std::size_t interfaces = 0;
+    /// \brief The global id set.
+    std::size_t global_id_set = 0;
+    /// \brief Bytes saved by reading the cell corners from the point
+    ///        geometries instead of a separate copy of all vertices.
+    ///
+    /// Not part of total().
+    std::size_t saved_vertex_copy = 0;
+
+    /// \brief The number of components, including saved_vertex_copy.
+    static constexpr int num_components = 9;
+
+    /// \brief The sum of all components that use memory.
+    std::size_t total() const
+    {
+        return topology + geometry + entity_data + zcorn + index_sets
+            + remote_indices + interfaces + global_id_set;
+    }
+
+    /// \brief Add the usage of another view or process.
+    MemoryUsage& operator+=(const MemoryUsage& other)
+    {
+        auto values = toArray();
+        const auto other_values = other.toArray();
+        for (int i = 0; i < num_components; ++i) {
+            values[i] += other_values[i];
+        }
+        fromArray(values);
+        return *this;
+    }
+
+    /// \brief Sum the usage over all processes of a communicator.
+    /// \param comm The collective communication object.
+    /// \return The component wise sum, available on all processes.
+    template<class CollectiveCommunication>
+    MemoryUsage sum(const CollectiveCommunication& comm) const
+    {
+        auto values = toArray();
+        comm.sum(values.data(), num_components);
+        MemoryUsage result;
+        result.fromArray(values);
+        return result;
+    }
+
+    /// \brief Maximum of the usage over all processes of a communicator.
+    /// \param comm The collective communication object.
+    /// \return The component wise maximum, available on all processes.
+    template<class CollectiveCommunication>
+    MemoryUsage max(const CollectiveCommunication& comm) const
+    {
+        auto values = toArray();
+        comm.max(values.data(), num_components);
+        MemoryUsage result;
+        result.fromArray(values);
+        return result;
+    }
+
+    /// \brief The components in the order of declaration.
+    std::array<std::size_t, num_components> toArray() const
+    {
+        return {{ topology, geometry, entity_data, zcorn, index_sets,
+                  remote_indices, interfaces, global_id_set, saved_vertex_copy }};
+    }
+
+    /// \brief Set the components from an array in the order of declaration.
+    void fromArray(const std::array<std::size_t, num_components>& values)
+    {
+        topology = values[0];
+        geometry = values[1];
+        entity_data = values[2];
+        zcorn = values[3];
+        index_sets = values[4];
+        remote_indices = values[5];
+        interfaces = values[6];
+        global_id_set = values[7];
+        saved_vertex_copy = values[8];
+    }
+};
+
+/// \brief The memory used by both views of a CpGrid in bytes.
+struct GridMemoryUsage
+{
+    /// \brief The view of the global grid (data_).
+    MemoryUsage global_view;
+    /// \brief The view of the distributed grid (distributed_data_).
+    ///
+    /// All zero if the grid has not been load balanced.
+    MemoryUsage distributed_view;
+
+    /// \brief The memory used by both views.
+    std::size_t total() const
+    {
+        return global_view.total() + distributed_view.total();
+    }
+
+    /// \brief Sum the usage over all processes of a communicator.
+    template<class CollectiveCommunication>
+    GridMemoryUsage sum(const CollectiveCommunication& comm) const
+    {
+        return GridMemoryUsage{ global_view.sum(comm), distributed_view.sum(comm) };
+    }
+
+    /// \brief Maximum of the usage over all processes of a communicator.
+    template<class CollectiveCommunication>
+    GridMemoryUsage max(const CollectiveCommunication& comm) const
+    {
+        return GridMemoryUsage{ global_view.max(comm), distributed_view.max(comm) };
+    }
+};
+
+/// \brief Print the components, one per line.
+inline std::ostream& operator<<(std::ostream& os, const MemoryUsage& usage)
+{
+    os << "topology:          " << usage.topology << '\n'
+       << "geometry:          " << usage.geometry << '\n'
+       << "entity data:       " << usage.entity_data << '\n'
+       << "zcorn:             " << usage.zcorn << '\n'
+       << "index sets:        " << usage.index_sets << '\n'
+       << "remote indices:    " << usage.remote_indices << '\n'
+       << "interfaces:        " << usage.interfaces << '\n'
+       << "global id set:     " << usage.global_id_set << '\n'
+       << "total:             " << usage.total() << '\n'
+       << "saved vertex copy: " << usage.saved_vertex_copy << '\n';
+    return os;
+}
+
+/// \brief Print both views.
+inline std::ostream& operator<<(std::ostream& os, const GridMemoryUsage& usage)
+{
+    os << "Global view (bytes):\n" << usage.global_view
+       << "Distributed view (bytes):\n" << usage.distributed_view;
+    return os;
+}
+
+/// \brief Estimate the bytes of a map from ranks to interface information.
+///
+/// Works for the interfaces of Dune::Interface and
+/// Dune::VariableSizeCommunicator<>::InterfaceMap.
+template<class InterfaceMap>
+std::size_t interfaceMapBytes(const InterfaceMap& interfaces)
+{
+    std::size_t bytes = 0;
+    for (const auto& entry : interfaces) {
+        // The map node holds the entry and three pointers.
+        bytes += sizeof(entry) + 3 * sizeof(void*);
+        bytes += (entry.second.first.size() + entry.second.second.size())
+            * sizeof(std::size_t);
+    }
+    return bytes;
+}
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // OPM_CPGRID_MEMORYUSAGE_HEADER
@@ -0,0 +1,53 @@
+//===========================================================================
+//
+// File: NonNeighbourConnection.hpp
+//
+// Created: Mon Oct 19 2026
+//
+//===========================================================================
+
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CPGRID_NONNEIGHBOURCONNECTION_HEADER
+#define OPM_CPGRID_NONNEIGHBOURCONNECTION_HEADER
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief A connection between two cells that do not share a face.
+///
+/// Such connections stem from faults, pinch-outs (see Opm::PinchProcessor)
+/// or the NNC keyword, and mirror Opm::NNCdata. CpGrid::loadBalance()
+/// expects the cells as logical Cartesian indices, internally they are
+/// converted to compressed cell indices.
+struct NonNeighbourConnection
+{
+    /// \brief The first cell of the connection.
+    int cell1;
+    /// \brief The second cell of the connection.
+    int cell2;
+    /// \brief The transmissibility of the connection.
+    double trans;
+};
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // OPM_CPGRID_NONNEIGHBOURCONNECTION_HEADER
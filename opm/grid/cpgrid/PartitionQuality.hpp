@@ -0,0 +1,108 @@
+//===========================================================================
+//
+// File: PartitionQuality.hpp
+//
+// Created: Mon Oct 19 2026
+//
+//===========================================================================
+
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CPGRID_PARTITIONQUALITY_HEADER
+#define OPM_CPGRID_PARTITIONQUALITY_HEADER
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <ostream>
+#include <vector>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief Quality measures of the partition computed by loadBalance().
+///
+/// The per rank vectors have one entry for each process of the distributed
+/// grid and are available on all of them. All vectors are empty if the grid
+/// has not been load balanced.
+struct PartitionQualityReport
+{
+    /// \brief The number of cells owned by each rank.
+    std::vector<int> owned_cells;
+    /// \brief The number of overlap cells of each rank.
+    std::vector<int> overlap_cells;
+    /// \brief The number of ranks each rank exchanges cell data with.
+    std::vector<int> neighbour_ranks;
+    /// \brief The number of cell values each rank sends in one communication
+    ///        over the InteriorBorder_All_Interface.
+    std::vector<int> halo_cells_sent;
+    /// \brief The number of cell values each rank receives in one
+    ///        communication over the InteriorBorder_All_Interface.
+    std::vector<int> halo_cells_received;
+    /// \brief The number of faces and non-neighbour connections between
+    ///        cells owned by different ranks.
+    std::size_t edge_cut = 0;
+    /// \brief The sum of the transmissibilities of the cut faces and
+    ///        non-neighbour connections.
+    ///
+    /// Equals edge_cut if loadBalance() got no transmissibilities.
+    double weighted_edge_cut = 0.0;
+    /// \brief The number of cut faces and non-neighbour connections whose
+    ///        cells are owned by processes on different nodes.
+    std::size_t inter_node_edge_cut = 0;
+    /// \brief The number of cells that postProcessPartitioningForWells()
+    ///        moved to another rank to keep wells on one process.
+    std::size_t cells_moved_for_wells = 0;
+
+    /// \brief The maximum number of owned cells relative to the average.
+    ///
+    /// 1 for a perfectly balanced partition.
+    double imbalance() const
+    {
+        if (owned_cells.empty()) {
+            return 1.0;
+        }
+        const double total = std::accumulate(owned_cells.begin(), owned_cells.end(), 0.0);
+        const int max_owned = *std::max_element(owned_cells.begin(), owned_cells.end());
+        return total > 0.0 ? max_owned * owned_cells.size() / total : 1.0;
+    }
+};
+
+/// \brief Print the report, one rank per line.
+inline std::ostream& operator<<(std::ostream& os, const PartitionQualityReport& report)
+{
+    os << "edge cut:              " << report.edge_cut << '\n'
+       << "weighted edge cut:     " << report.weighted_edge_cut << '\n'
+       << "inter-node edge cut:   " << report.inter_node_edge_cut << '\n'
+       << "imbalance:             " << report.imbalance() << '\n'
+       << "cells moved for wells: " << report.cells_moved_for_wells << '\n'
+       << "rank: owned overlap neighbours halo_sent halo_received\n";
+    for (std::size_t rank = 0; rank < report.owned_cells.size(); ++rank) {
+        os << rank << ": " << report.owned_cells[rank] << ' '
+           << report.overlap_cells[rank] << ' ' << report.neighbour_ranks[rank] << ' '
+           << report.halo_cells_sent[rank] << ' ' << report.halo_cells_received[rank] << '\n';
+    }
+    return os;
+}
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // OPM_CPGRID_PARTITIONQUALITY_HEADER
@@ -0,0 +1,195 @@
+//===========================================================================
+//
+// File: PhaseTimings.hpp
+//
+// Created: Mon Oct 19 2026
+//
+//===========================================================================
+
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CPGRID_PHASETIMINGS_HEADER
+#define OPM_CPGRID_PHASETIMINGS_HEADER
+
+#include <array>
+#include <chrono>
+#include <ostream>
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+/// \brief The timed phases of grid construction and distribution.
+enum class GridPhase
+{
+    RepairZcorn,      ///< Sanitizing the ZCORN input.
+    Minpv,            ///< MINPV processing.
+    UniquePoints,     ///< Finding the unique points along the pillars.
+    VerticalFaces,    ///< Processing the vertical faces.
+    HorizontalFaces,  ///< Processing the horizontal faces.
+    Topology,         ///< Building the topology tables.
+    Geometry,         ///< Computing the geometries.
+    Partitioning,     ///< Partitioning the cells for load balancing.
+    Overlap,          ///< Adding the overlap layers.
+    IndexSet,         ///< Setting up the parallel index set.
+    RemoteIndices,    ///< Setting up the remote indices.
+    Interfaces        ///< Creating the communication interfaces.
+};
+
+/// \brief The number of values of GridPhase.
+constexpr int numGridPhases = 12;
+
+/// \brief Get a human readable name of a phase.
+inline const char* gridPhaseName(GridPhase phase)
+{
+    switch (phase) {
+    case GridPhase::RepairZcorn: return "repair zcorn";
+    case GridPhase::Minpv: return "minpv";
+    case GridPhase::UniquePoints: return "unique points";
+    case GridPhase::VerticalFaces: return "vertical faces";
+    case GridPhase::HorizontalFaces: return "horizontal faces";
+    case GridPhase::Topology: return "topology";
+    case GridPhase::Geometry: return "geometry";
+    case GridPhase::Partitioning: return "partitioning";
+    case GridPhase::Overlap: return "overlap";
+    case GridPhase::IndexSet: return "index set";
+    case GridPhase::RemoteIndices: return "remote indices";
+    case GridPhase::Interfaces: return "interfaces";
+    }
+    return "unknown";
+}
+
+/// \brief The time spent in the phases on one process, in seconds.
+class PhaseTimings
+{
+public:
+    PhaseTimings()
+    {
+        seconds_.fill(0.0);
+    }
+
+    /// \brief Add time to a phase.
+    void add(GridPhase phase, double seconds)
+    {
+        seconds_[static_cast<int>(phase)] += seconds;
+    }
+
+    /// \brief The time spent in a phase.
+    double seconds(GridPhase phase) const
+    {
+        return seconds_[static_cast<int>(phase)];
+    }
+
+    /// \brief The time spent in all phases.
+    const std::array<double, numGridPhases>& allSeconds() const
+    {
+        return seconds_;
+    }
+
+    /// \brief Add the times of another object.
+    PhaseTimings& operator+=(const PhaseTimings& other)
+    {
+        for (int i = 0; i < numGridPhases; ++i) {
+            seconds_[i] += other.seconds_[i];
+        }
+        return *this;
+    }
+
+    /// \brief Adds the wall clock time between construction and stop()
+    ///        (or destruction) to a phase.
+    class Scope
+    {
+    public:
+        Scope(PhaseTimings& timings, GridPhase phase)
+            : timings_(&timings), phase_(phase), start_(Clock::now())
+        {
+        }
+        ~Scope()
+        {
+            stop();
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        /// \brief Stop timing. Further calls have no effect.
+        void stop()
+        {
+            if (timings_) {
+                const std::chrono::duration<double> elapsed = Clock::now() - start_;
+                timings_->add(phase_, elapsed.count());
+                timings_ = nullptr;
+            }
+        }
+    private:
+        typedef std::chrono::steady_clock Clock;
+        PhaseTimings* timings_;
+        GridPhase phase_;
+        Clock::time_point start_;
+    };
+
+private:
+    std::array<double, numGridPhases> seconds_;
+};
+
+/// \brief Statistics of the phase timings over the processes.
+struct PhaseTimingReport
+{
+    /// \brief The minimum time over the processes per phase.
+    std::array<double, numGridPhases> min;
+    /// \brief The maximum time over the processes per phase.
+    std::array<double, numGridPhases> max;
+    /// \brief The average time over the processes per phase.
+    std::array<double, numGridPhases> avg;
+
+    /// \brief Compute the statistics of the timings of all processes.
+    ///
+    /// Collective over the communicator.
+    /// \param timings The timings of this process.
+    /// \param comm The collective communication object.
+    template<class CollectiveCommunication>
+    static PhaseTimingReport create(const PhaseTimings& timings,
+                                    const CollectiveCommunication& comm)
+    {
+        PhaseTimingReport report;
+        report.min = report.max = report.avg = timings.allSeconds();
+        comm.min(report.min.data(), numGridPhases);
+        comm.max(report.max.data(), numGridPhases);
+        comm.sum(report.avg.data(), numGridPhases);
+        for (auto& seconds : report.avg) {
+            seconds /= comm.size();
+        }
+        return report;
+    }
+};
+
+/// \brief Print the statistics, one phase per line.
+inline std::ostream& operator<<(std::ostream& os, const PhaseTimingReport& report)
+{
+    os << "phase (seconds): min max avg\n";
+    for (int i = 0; i < numGridPhases; ++i) {
+        os << gridPhaseName(static_cast<GridPhase>(i)) << ": "
+           << report.min[i] << ' ' << report.max[i] << ' ' << report.avg[i] << '\n';
+    }
+    return os;
+}
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // OPM_CPGRID_PHASETIMINGS_HEADER
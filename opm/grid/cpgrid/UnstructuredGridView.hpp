@@ -0,0 +1,90 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_UNSTRUCTUREDGRIDVIEW_HEADER_INCLUDED
+#define OPM_UNSTRUCTUREDGRIDVIEW_HEADER_INCLUDED
+
+#include <opm/grid/UnstructuredGrid.h>
+
+#include <vector>
+
+namespace Dune
+{
+
+class CpGrid;
+
+namespace cpgrid
+{
+
+class CpGridData;
+
+/// \brief An UnstructuredGrid describing the current view of a CpGrid.
+///
+/// No corner-point processing is done. The arrays whose layout is the
+/// same in both grids are shared with the CpGrid:
+/// node_coordinates, face_nodes, face_nodepos, face_cells, cell_facepos,
+/// global_cell and zcorn. Only cell_faces, cell_facetag, face_centroids,
+/// face_normals, face_areas, cell_centroids and cell_volumes are stored
+/// here, since CpGrid keeps the orientation in the face indices, the face
+/// tags per face, unit normals and the centroids, areas and volumes inside
+/// its geometry objects.
+///
+/// The CpGrid has to outlive the view, and its current view must not
+/// change, e.g. by loadBalance() or switchToGlobalView(). The grid is to
+/// be treated as read-only and must not be passed to destroy_grid().
+class UnstructuredGridView
+{
+public:
+    /// \brief Describe the current view of a grid.
+    explicit UnstructuredGridView(const CpGrid& grid);
+
+    UnstructuredGridView(const UnstructuredGridView&) = delete;
+    UnstructuredGridView& operator=(const UnstructuredGridView&) = delete;
+    // Moving the vectors keeps the pointers of grid_ valid.
+    UnstructuredGridView(UnstructuredGridView&&) = default;
+    UnstructuredGridView& operator=(UnstructuredGridView&&) = default;
+
+    /// \brief Get the grid.
+    const UnstructuredGrid& grid() const
+    {
+        return grid_;
+    }
+
+    /// \brief Get the grid.
+    operator const UnstructuredGrid&() const
+    {
+        return grid_;
+    }
+
+private:
+    friend class CpGridData;
+
+    UnstructuredGrid grid_;
+    std::vector<int> cell_faces_;
+    std::vector<int> cell_facetag_;
+    std::vector<double> face_centroids_;
+    std::vector<double> face_normals_;
+    std::vector<double> face_areas_;
+    std::vector<double> cell_centroids_;
+    std::vector<double> cell_volumes_;
+    /// The node coordinates, if the point geometries cannot be shared.
+    std::vector<double> node_coordinates_;
+};
+
+} // end namespace cpgrid
+} // end namespace Dune
+
+#endif // OPM_UNSTRUCTUREDGRIDVIEW_HEADER_INCLUDED
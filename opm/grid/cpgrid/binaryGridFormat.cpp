@@ -0,0 +1,489 @@
+//===========================================================================
+//
+// File: binaryGridFormat.cpp
+//
+// Created: Mon Oct 19 2026
+//
+//===========================================================================
+
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <opm/grid/grid_file.h>
+#include <opm/grid/utility/ErrorMacros.hpp>
+#include "CpGridData.hpp"
+#include "Indexsets.hpp"
+#include "PartitionTypeIndicator.hpp"
+
+#if HAVE_MPI
+#include <dune/common/parallel/remoteindices.hh>
+#endif
+
+namespace Dune
+{
+
+    namespace
+    {
+        const char* const cpgrid_kind = "cpgrid";
+
+        typedef FieldVector<double, 3> point_t;
+
+        /// Store an oriented entity as its index, or the bitwise
+        /// complement of it for negative orientation.
+        template <int codim>
+        int signedIndex(const cpgrid::EntityRep<codim>& e)
+        {
+            return e.orientation() ? e.index() : ~e.index();
+        }
+
+        template <int codim>
+        cpgrid::EntityRep<codim> fromSignedIndex(int i)
+        {
+            return cpgrid::EntityRep<codim>(i < 0 ? ~i : i, i >= 0);
+        }
+
+        /// Flatten a sparse table into row offsets and entries.
+        template <class T, class Convert>
+        void flatten(const Opm::SparseTable<T>& table, Convert convert,
+                     std::vector<int>& pos, std::vector<int>& entries)
+        {
+            pos.assign(1, 0);
+            entries.clear();
+            entries.reserve(table.dataSize());
+            for (int row = 0; row < table.size(); ++row) {
+                for (const auto& entry : table[row]) {
+                    entries.push_back(convert(entry));
+                }
+                pos.push_back(entries.size());
+            }
+        }
+
+        /// Closes the grid file when going out of scope.
+        struct GridFileCloser
+        {
+            void operator()(grid_file* f) const
+            {
+                close_grid_file(f);
+            }
+        };
+        typedef std::unique_ptr<grid_file, GridFileCloser> GridFilePtr;
+
+        GridFilePtr openGridFile(const std::string& filename)
+        {
+            GridFilePtr file(open_grid_file(filename.c_str(), cpgrid_kind));
+            if (!file) {
+                OPM_THROW(std::runtime_error, "Could not open grid file " << filename
+                          << ". It may not exist, be corrupt, of another version or byte order.");
+            }
+            return file;
+        }
+
+        /// Get a section of the expected type, throw if it is missing
+        /// or corrupt.
+        template <class T>
+        const T* getSection(const grid_file* f, const std::string& filename,
+                            const char* name, std::size_t& count)
+        {
+            const grid_file_type type = std::is_same<T, double>::value
+                ? GRID_FILE_FLOAT64 : GRID_FILE_INT32;
+            const void* data = grid_file_section(f, name, type, &count);
+            if (data == nullptr) {
+                OPM_THROW(std::runtime_error, "Section " << name << " of grid file "
+                          << filename << " is missing or corrupt.");
+            }
+            return static_cast<const T*>(data);
+        }
+
+        /// Get a section of the expected type and size.
+        template <class T>
+        const T* getSection(const grid_file* f, const std::string& filename,
+                            const char* name, std::size_t expected_count)
+        {
+            std::size_t count = 0;
+            const T* data = getSection<T>(f, filename, name, count);
+            if (count != expected_count) {
+                OPM_THROW(std::runtime_error, "Section " << name << " of grid file "
+                          << filename << " has " << count << " elements, expected "
+                          << expected_count);
+            }
+            return data;
+        }
+
+        /// Row sizes from row offsets.
+        std::vector<int> rowSizes(const int* pos, int num_rows)
+        {
+            std::vector<int> sizes(num_rows);
+            for (int row = 0; row < num_rows; ++row) {
+                sizes[row] = pos[row + 1] - pos[row];
+            }
+            return sizes;
+        }
+    } // anon namespace
+
+
+
+    /// Write the binary grid file format.
+    void cpgrid::CpGridData::writeBinaryFormat(const std::string& filename) const
+    {
+        writeBinaryFormat(filename, std::vector<grid_file_section>());
+    }
+
+
+
+    void cpgrid::CpGridData::writeBinaryFormat(const std::string& filename,
+                                               const std::vector<grid_file_section>& extra_sections) const
+    {
+        const int num_cells = size(0);
+        const int num_faces = face_to_cell_.size();
+        const int num_points = size(3);
+        const int meta[6] = { num_cells, num_faces, num_points,
+                              logical_cartesian_size_[0], logical_cartesian_size_[1],
+                              logical_cartesian_size_[2] };
+
+        // Topology.
+        std::vector<int> cell_facepos, cell_faces;
+        flatten(static_cast<const Opm::SparseTable<EntityRep<1> >&>(cell_to_face_),
+                signedIndex<1>, cell_facepos, cell_faces);
+        std::vector<int> face_cellpos, face_cells;
+        flatten(static_cast<const Opm::SparseTable<EntityRep<0> >&>(face_to_cell_),
+                signedIndex<0>, face_cellpos, face_cells);
+        std::vector<int> face_nodepos, face_nodes;
+        flatten(face_to_point_, [](int p) { return p; }, face_nodepos, face_nodes);
+        std::vector<int> face_tags(face_tag_.size());
+        for (int face = 0; face < num_faces; ++face) {
+            face_tags[face] = face_tag_.get(face);
+        }
+
+        // Geometry.
+        std::vector<double> points, face_centroids, face_areas, face_normals;
+        std::vector<double> cell_centroids, cell_volumes;
+        const std::vector<cpgrid::Geometry<0, 3> >& point_geom = geometry_.geomVector<3>();
+        for (const auto& p : point_geom) {
+            points.insert(points.end(), p.center().begin(), p.center().end());
+        }
+        const std::vector<cpgrid::Geometry<2, 3> >& face_geom = geometry_.geomVector<1>();
+        const std::vector<PointType>& normals = face_normals_;
+        for (int face = 0; face < num_faces; ++face) {
+            face_centroids.insert(face_centroids.end(), face_geom[face].center().begin(),
+                                  face_geom[face].center().end());
+            face_areas.push_back(face_geom[face].volume());
+            face_normals.insert(face_normals.end(), normals[face].begin(), normals[face].end());
+        }
+        const std::vector<cpgrid::Geometry<3, 3> >& cell_geom = geometry_.geomVector<0>();
+        for (const auto& c : cell_geom) {
+            cell_centroids.insert(cell_centroids.end(), c.center().begin(), c.center().end());
+            cell_volumes.push_back(c.volume());
+        }
+
+        std::vector<grid_file_section> sections = {
+            { "meta",           GRID_FILE_INT32,   6,                    meta },
+            { "cell_facepos",   GRID_FILE_INT32,   cell_facepos.size(),  cell_facepos.data() },
+            { "cell_faces",     GRID_FILE_INT32,   cell_faces.size(),    cell_faces.data() },
+            { "face_cellpos",   GRID_FILE_INT32,   face_cellpos.size(),  face_cellpos.data() },
+            { "face_cells",     GRID_FILE_INT32,   face_cells.size(),    face_cells.data() },
+            { "face_nodepos",   GRID_FILE_INT32,   face_nodepos.size(),  face_nodepos.data() },
+            { "face_nodes",     GRID_FILE_INT32,   face_nodes.size(),    face_nodes.data() },
+            { "cell_points",    GRID_FILE_INT32,   8 * cell_to_point_.size(),
+              cell_to_point_.empty() ? nullptr : cell_to_point_[0].data() },
+            { "face_tags",      GRID_FILE_INT32,   face_tags.size(),     face_tags.data() },
+            { "global_cell",    GRID_FILE_INT32,   global_cell_.size(),  global_cell_.data() },
+            { "points",         GRID_FILE_FLOAT64, points.size(),        points.data() },
+            { "face_centroids", GRID_FILE_FLOAT64, face_centroids.size(), face_centroids.data() },
+            { "face_areas",     GRID_FILE_FLOAT64, face_areas.size(),    face_areas.data() },
+            { "face_normals",   GRID_FILE_FLOAT64, face_normals.size(),  face_normals.data() },
+            { "cell_centroids", GRID_FILE_FLOAT64, cell_centroids.size(), cell_centroids.data() },
+            { "cell_volumes",   GRID_FILE_FLOAT64, cell_volumes.size(),  cell_volumes.data() }
+        };
+        if (!zcorn.empty()) {
+            sections.push_back({ "zcorn", GRID_FILE_FLOAT64, zcorn.size(), zcorn.data() });
+        }
+        sections.insert(sections.end(), extra_sections.begin(), extra_sections.end());
+
+        if (!write_grid_file(filename.c_str(), cpgrid_kind, sections.data(), sections.size())) {
+            OPM_THROW(std::runtime_error, "Could not write grid file " << filename);
+        }
+    }
+
+
+
+    /// Read the binary grid file format.
+    void cpgrid::CpGridData::readBinaryFormat(const std::string& filename)
+    {
+        GridFilePtr file = openGridFile(filename);
+        readBinaryFormat(file.get(), filename);
+    }
+
+
+
+    void cpgrid::CpGridData::readBinaryFormat(const grid_file* f, const std::string& filename)
+    {
+
+        const int* meta = getSection<int>(f, filename, "meta", 6);
+        const int num_cells = meta[0];
+        const int num_faces = meta[1];
+        const int num_points = meta[2];
+        std::copy(meta + 3, meta + 6, logical_cartesian_size_.begin());
+
+        // Topology. The number of entries of each table is its last offset.
+        const int* cell_facepos = getSection<int>(f, filename, "cell_facepos", num_cells + 1);
+        const int* cell_faces = getSection<int>(f, filename, "cell_faces", cell_facepos[num_cells]);
+        std::vector<EntityRep<1> > c2f;
+        c2f.reserve(cell_facepos[num_cells]);
+        for (int i = 0; i < cell_facepos[num_cells]; ++i) {
+            c2f.push_back(fromSignedIndex<1>(cell_faces[i]));
+        }
+        const auto cell_sizes = rowSizes(cell_facepos, num_cells);
+        cell_to_face_ = OrientedEntityTable<0, 1>(c2f.begin(), c2f.end(),
+                                                  cell_sizes.begin(), cell_sizes.end());
+
+        const int* face_cellpos = getSection<int>(f, filename, "face_cellpos", num_faces + 1);
+        const int* face_cells = getSection<int>(f, filename, "face_cells", face_cellpos[num_faces]);
+        std::vector<EntityRep<0> > f2c;
+        f2c.reserve(face_cellpos[num_faces]);
+        for (int i = 0; i < face_cellpos[num_faces]; ++i) {
+            f2c.push_back(fromSignedIndex<0>(face_cells[i]));
+        }
+        const auto face_cell_sizes = rowSizes(face_cellpos, num_faces);
+        face_to_cell_ = OrientedEntityTable<1, 0>(f2c.begin(), f2c.end(),
+                                                  face_cell_sizes.begin(), face_cell_sizes.end());
+        computeFaceCells();
+
+        const int* face_nodepos = getSection<int>(f, filename, "face_nodepos", num_faces + 1);
+        const int* face_nodes = getSection<int>(f, filename, "face_nodes", face_nodepos[num_faces]);
+        const auto face_node_sizes = rowSizes(face_nodepos, num_faces);
+        face_to_point_ = Opm::SparseTable<int>(face_nodes, face_nodes + face_nodepos[num_faces],
+                                               face_node_sizes.begin(), face_node_sizes.end());
+
+        const int* cell_points = getSection<int>(f, filename, "cell_points", 8 * num_cells);
+        cell_to_point_.resize(num_cells);
+        for (int c = 0; c < num_cells; ++c) {
+            std::copy(cell_points + 8*c, cell_points + 8*(c + 1), cell_to_point_[c].begin());
+        }
+
+        const int* tags = getSection<int>(f, filename, "face_tags", num_faces);
+        std::vector<enum face_tag> face_tags(num_faces);
+        for (int face = 0; face < num_faces; ++face) {
+            face_tags[face] = static_cast<enum face_tag>(tags[face]);
+        }
+        face_tag_.assign(face_tags.begin(), face_tags.end());
+
+        const int* global_cell = getSection<int>(f, filename, "global_cell", num_cells);
+        global_cell_.assign(global_cell, global_cell + num_cells);
+
+        // Geometry, with the cell corners referring to the point geometries.
+        const double* points = getSection<double>(f, filename, "points", 3 * num_points);
+        const double* face_centroids = getSection<double>(f, filename, "face_centroids", 3 * num_faces);
+        const double* face_areas = getSection<double>(f, filename, "face_areas", num_faces);
+        const double* face_normals = getSection<double>(f, filename, "face_normals", 3 * num_faces);
+        const double* cell_centroids = getSection<double>(f, filename, "cell_centroids", 3 * num_cells);
+        const double* cell_volumes = getSection<double>(f, filename, "cell_volumes", num_cells);
+
+        auto point = [](const double* p) { return point_t{ p[0], p[1], p[2] }; };
+        std::vector<cpgrid::Geometry<0, 3> > pg;
+        pg.reserve(num_points);
+        for (int i = 0; i < num_points; ++i) {
+            pg.emplace_back(point(points + 3*i));
+        }
+        EntityVariable<cpgrid::Geometry<0, 3>, 3> pointgeom;
+        pointgeom.assign(pg.begin(), pg.end());
+        std::vector<cpgrid::Geometry<3, 3> > cg;
+        cg.reserve(num_cells);
+        const cpgrid::Geometry<0, 3>* allcorners = pointgeom.empty() ? 0 : &pointgeom.get(0);
+        for (int c = 0; c < num_cells; ++c) {
+            cg.emplace_back(point(cell_centroids + 3*c), cell_volumes[c],
+                            allcorners, &cell_to_point_[c][0]);
+        }
+        EntityVariable<cpgrid::Geometry<3, 3>, 0> cellgeom;
+        cellgeom.assign(cg.begin(), cg.end());
+        std::vector<cpgrid::Geometry<2, 3> > fg;
+        std::vector<point_t> normals;
+        fg.reserve(num_faces);
+        normals.reserve(num_faces);
+        for (int face = 0; face < num_faces; ++face) {
+            fg.emplace_back(point(face_centroids + 3*face), face_areas[face]);
+            normals.push_back(point(face_normals + 3*face));
+        }
+        EntityVariable<cpgrid::Geometry<2, 3>, 1> facegeom;
+        facegeom.assign(fg.begin(), fg.end());
+        // Moved rather than copied, to keep the cell corners valid.
+        geometry_ = cpgrid::DefaultGeometryPolicy(std::move(cellgeom), std::move(facegeom),
+                                                  std::move(pointgeom));
+        face_normals_.assign(normals.begin(), normals.end());
+
+        if (grid_file_has_section(f, "zcorn")) {
+            std::size_t num_zcorn = 0;
+            const void* zcorn_data = grid_file_section(f, "zcorn", GRID_FILE_FLOAT64, &num_zcorn);
+            if (zcorn_data == nullptr) {
+                OPM_THROW(std::runtime_error, "Section zcorn of grid file " << filename
+                          << " is corrupt.");
+            }
+            const double* z = static_cast<const double*>(zcorn_data);
+            zcorn.assign(z, z + num_zcorn);
+        }
+
+        computeUniqueBoundaryIds();
+    }
+
+
+
+    /// Write the distributed view of this process.
+    void cpgrid::CpGridData::writeCheckpoint(const std::string& filename) const
+    {
+#if HAVE_MPI
+        const int comm[2] = { ccobj_.rank(), ccobj_.size() };
+
+        // Triplets of global index, local index and attribute.
+        std::vector<int> index_set;
+        index_set.reserve(3 * cell_indexset_.size());
+        for (const auto& index : cell_indexset_) {
+            index_set.push_back(index.global());
+            index_set.push_back(index.local().local());
+            index_set.push_back(index.local().attribute());
+        }
+
+        // For each neighbour its rank, the number of remote indices and
+        // pairs of global index and remote attribute.
+        std::vector<int> remote_indices;
+        for (auto it = cell_remote_indices_.begin(); it != cell_remote_indices_.end(); ++it) {
+            const auto& list = *it->second.first;
+            remote_indices.push_back(it->first);
+            remote_indices.push_back(list.size());
+            for (const auto& remote : list) {
+                remote_indices.push_back(remote.localIndexPair().global());
+                remote_indices.push_back(remote.attribute());
+            }
+        }
+
+        const std::vector<int>& cell_ids = global_id_set_->getMapping<0>();
+        const std::vector<int>& face_ids = global_id_set_->getMapping<1>();
+        const std::vector<int>& point_ids = global_id_set_->getMapping<3>();
+        const std::vector<int> cell_types(partition_type_indicator_->cell_indicator_.begin(),
+                                          partition_type_indicator_->cell_indicator_.end());
+        const std::vector<int> point_types(partition_type_indicator_->point_indicator_.begin(),
+                                           partition_type_indicator_->point_indicator_.end());
+        std::vector<int> boundary_ids(unique_boundary_ids_.size());
+        for (std::size_t face = 0; face < boundary_ids.size(); ++face) {
+            boundary_ids[face] = unique_boundary_ids_.get(face);
+        }
+
+        const std::vector<grid_file_section> sections = {
+            { "comm",           GRID_FILE_INT32, 2,                     comm },
+            { "index_set",      GRID_FILE_INT32, index_set.size(),      index_set.data() },
+            { "remote_indices", GRID_FILE_INT32, remote_indices.size(), remote_indices.data() },
+            { "cell_ids",       GRID_FILE_INT32, cell_ids.size(),       cell_ids.data() },
+            { "face_ids",       GRID_FILE_INT32, face_ids.size(),       face_ids.data() },
+            { "point_ids",      GRID_FILE_INT32, point_ids.size(),      point_ids.data() },
+            { "cell_types",     GRID_FILE_INT32, cell_types.size(),     cell_types.data() },
+            { "point_types",    GRID_FILE_INT32, point_types.size(),    point_types.data() },
+            { "boundary_ids",   GRID_FILE_INT32, boundary_ids.size(),   boundary_ids.data() }
+        };
+        writeBinaryFormat(filename, sections);
+#else
+        static_cast<void>(filename);
+        OPM_THROW(std::runtime_error, "Checkpointing a distributed grid needs MPI.");
+#endif
+    }
+
+
+
+    /// Restore the distributed view of this process.
+    void cpgrid::CpGridData::readCheckpoint(const std::string& filename)
+    {
+#if HAVE_MPI
+        GridFilePtr file = openGridFile(filename);
+        const grid_file* f = file.get();
+
+        const int* comm = getSection<int>(f, filename, "comm", 2);
+        if (comm[0] != ccobj_.rank() || comm[1] != ccobj_.size()) {
+            OPM_THROW(std::runtime_error, "Checkpoint " << filename << " was written by rank "
+                      << comm[0] << " of " << comm[1] << " processes, not by rank "
+                      << ccobj_.rank() << " of " << ccobj_.size());
+        }
+        readBinaryFormat(f, filename);
+        const int num_cells = size(0);
+        const int num_faces = face_to_cell_.size();
+        const int num_points = size(3);
+
+        const int* index_set = getSection<int>(f, filename, "index_set", 3 * std::size_t(num_cells));
+        typedef Dune::ParallelLocalIndex<AttributeSet> Index;
+        cell_indexset_.beginResize();
+        for (int i = 0; i < num_cells; ++i) {
+            cell_indexset_.add(index_set[3*i],
+                               Index(index_set[3*i + 1], AttributeSet(index_set[3*i + 2]), true));
+        }
+        cell_indexset_.endResize();
+
+        // The remote indices are stored sorted by global index, the order
+        // the modifiers need.
+        std::size_t count = 0;
+        const int* remote_indices = getSection<int>(f, filename, "remote_indices", count);
+        typedef RemoteIndexListModifier<RemoteIndices::ParallelIndexSet, RemoteIndices::Allocator,
+                                        false> Modifier;
+        typedef RemoteIndices::RemoteIndex RemoteIndex;
+        cell_remote_indices_.setIndexSets(cell_indexset_, cell_indexset_, ccobj_);
+        if (count == 0) {
+            // Force update of the sync counter in the remote indices.
+            cell_remote_indices_.getModifier<false,false>(0);
+        }
+        for (std::size_t pos = 0; pos + 2 <= count; ) {
+            const int rank = remote_indices[pos];
+            const int num_remote = remote_indices[pos + 1];
+            pos += 2;
+            if (pos + 2 * std::size_t(num_remote) > count) {
+                OPM_THROW(std::runtime_error, "Corrupt remote indices in " << filename);
+            }
+            Modifier modifier = cell_remote_indices_.getModifier<false,false>(rank);
+            for (int i = 0; i < num_remote; ++i, pos += 2) {
+                modifier.insert(RemoteIndex(AttributeSet(remote_indices[pos + 1]),
+                                            &cell_indexset_.at(remote_indices[pos])));
+            }
+        }
+
+        const int* cell_ids = getSection<int>(f, filename, "cell_ids", num_cells);
+        const int* face_ids = getSection<int>(f, filename, "face_ids", num_faces);
+        const int* point_ids = getSection<int>(f, filename, "point_ids", num_points);
+        std::vector<int> cell_mapping(cell_ids, cell_ids + num_cells);
+        std::vector<int> face_mapping(face_ids, face_ids + num_faces);
+        std::vector<int> point_mapping(point_ids, point_ids + num_points);
+        global_id_set_->swap(cell_mapping, face_mapping, point_mapping);
+
+        const int* cell_types = getSection<int>(f, filename, "cell_types", num_cells);
+        const int* point_types = getSection<int>(f, filename, "point_types", num_points);
+        partition_type_indicator_->cell_indicator_.assign(cell_types, cell_types + num_cells);
+        partition_type_indicator_->point_indicator_.assign(point_types, point_types + num_points);
+        computePartitionEntities();
+
+        const int* boundary_ids = getSection<int>(f, filename, "boundary_ids", count);
+        unique_boundary_ids_.assign(boundary_ids, boundary_ids + count);
+
+        computeInterfaces();
+#else
+        static_cast<void>(filename);
+        OPM_THROW(std::runtime_error, "Restoring a distributed grid needs MPI.");
+#endif
+    }
+
+} // namespace Dune
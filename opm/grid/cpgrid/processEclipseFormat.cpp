@@ -93,7 +93,6 @@ namespace Dune
                        const std::vector<int>& face_to_output_face,
                        cpgrid::DefaultGeometryPolicy& gpol,
                        cpgrid::SignedEntityVariable<FieldVector<double, 3> , 1>& normals,
-                       std::vector<FieldVector<double, 3> >& allcorners,
                        bool turn_normals);
     } // anon namespace
 
@@ -114,7 +113,9 @@ namespace cpgrid
         ecl_grid.exportACTNUM(actnumData);
 
         // Mutable because grdecl::zcorn is non-const.
+        PhaseTimings::Scope repair_timer(phase_timings_, GridPhase::RepairZcorn);
         auto zcornData = getSanitizedZCORN(ecl_grid, actnumData);
+        repair_timer.stop();
 
         // Make input struct for processing code.
         grdecl g;
@@ -128,6 +129,7 @@ namespace cpgrid
 
         // Possibly process MINPV
         if (!poreVolume.empty() && (ecl_grid.getMinpvMode() != Opm::MinpvMode::ModeEnum::Inactive)) {
+            PhaseTimings::Scope minpv_timer(phase_timings_, GridPhase::Minpv);
             Opm::MinpvProcessor mp(g.dims[0], g.dims[1], g.dims[2]);
             // Currently the pinchProcessor is not used and only opmfil is supported
             //bool opmfil = ecl_grid.getMinpvMode() == Opm::MinpvMode::OpmFIL;
@@ -212,7 +214,12 @@ namespace cpgrid
         std::cout << "Processing eclipse data." << std::endl;
 #endif
         processed_grid output;
-        process_grdecl(&input_data, z_tolerance, &output);
+        processed_grid_timings timings;
+        process_grdecl_timed(&input_data, z_tolerance, &output, &timings);
+        phase_timings_.add(GridPhase::UniquePoints, timings.unique_points);
+        phase_timings_.add(GridPhase::VerticalFaces, timings.vertical_faces);
+        phase_timings_.add(GridPhase::HorizontalFaces, timings.horizontal_faces);
+        PhaseTimings::Scope topology_timer(phase_timings_, GridPhase::Topology);
         if (remove_ij_boundary) {
             removeOuterCellLayer(output);
             // removeUnusedNodes(output);
@@ -224,12 +231,16 @@ namespace cpgrid
 #endif
         std::vector<int> face_to_output_face;
         buildTopo(output, global_cell_, cell_to_face_, face_to_cell_, face_to_point_, cell_to_point_, face_to_output_face);
+        computeFaceCells();
         std::copy(output.dimensions, output.dimensions + 3, logical_cartesian_size_.begin());
+        topology_timer.stop();
 
 #ifdef VERBOSE
         std::cout << "Building geometry." << std::endl;
 #endif
-        buildGeom(output, cell_to_face_, cell_to_point_, face_to_output_face, geometry_, face_normals_, allcorners_, turn_normals);
+        PhaseTimings::Scope geometry_timer(phase_timings_, GridPhase::Geometry);
+        buildGeom(output, cell_to_face_, cell_to_point_, face_to_output_face, geometry_, face_normals_, turn_normals);
+        geometry_timer.stop();
 
 #ifdef VERBOSE
         std::cout << "Assigning face tags." << std::endl;
@@ -763,8 +774,8 @@ namespace cpgrid
         template <>
         struct MakeGeometry<3>
         {
-            const FieldVector<double, 3>* allcorners_;
-            MakeGeometry(const FieldVector<double, 3>* allcorners)
+            const cpgrid::Geometry<0, 3>* allcorners_;
+            MakeGeometry(const cpgrid::Geometry<0, 3>* allcorners)
                 : allcorners_(allcorners)
             {
             }
@@ -794,11 +805,10 @@ namespace cpgrid
                        const std::vector<int>& face_to_output_face,
                        cpgrid::DefaultGeometryPolicy& gpol,
                        cpgrid::SignedEntityVariable<FieldVector<double, 3>, 1>& normals,
-                       std::vector<FieldVector<double, 3> >& allcorners,
                        bool turn_normals)
         {
             typedef FieldVector<double, 3> point_t;
-            std::vector<point_t>& points = allcorners;
+            std::vector<point_t> points;
             std::vector<point_t> face_normals;
             std::vector<point_t> face_centroids;
             std::vector<double>  face_areas;
@@ -895,11 +905,18 @@ namespace cpgrid
             // B) wordy,
             // C) slow
             // D) copied from readSintefLegacyFormat.cpp
-            // Cells
+            // Points
+            cpgrid::EntityVariable<cpgrid::Geometry<0, 3>, 3> pointgeom;
+            std::vector<cpgrid::Geometry<0, 3> > pg;
+            MakeGeometry<0> mpointg;
+            std::transform(points.begin(), points.end(),
+                           std::back_inserter(pg), mpointg);
+            pointgeom.assign(pg.begin(), pg.end());
+            // Cells, with corners referring to the point geometries.
             cpgrid::EntityVariable<cpgrid::Geometry<3, 3>, 0> cellgeom;
             std::vector<cpgrid::Geometry<3, 3> > cg;
             cg.reserve(nc);
-            MakeGeometry<3> mcellg(&allcorners[0]);
+            MakeGeometry<3> mcellg(pointgeom.empty() ? 0 : &pointgeom.get(0));
 //             std::transform(cell_centroids.begin(), cell_centroids.end(),
 //                            cell_volumes.begin(),
 //                            std::back_inserter(cg), mcellg);
@@ -915,26 +932,20 @@ namespace cpgrid
                            face_areas.begin(),
                            std::back_inserter(fg), mfaceg);
             facegeom.assign(fg.begin(), fg.end());
-            // Points
-            cpgrid::EntityVariable<cpgrid::Geometry<0, 3>, 3> pointgeom;
-            std::vector<cpgrid::Geometry<0, 3> > pg;
-            MakeGeometry<0> mpointg;
-            std::transform(points.begin(), points.end(),
-                           std::back_inserter(pg), mpointg);
-            pointgeom.assign(pg.begin(), pg.end());
 #ifdef VERBOSE
             std::cout << "Transforms/copies:  " << clock.secsSinceLast() << std::endl;
 #endif
 
-            // The final, combined object (yes, a lot of copying goes on here).
             if (turn_normals) {
                 int num_normals = face_normals.size();
                 for (int i = 0; i < num_normals; ++i) {
                     face_normals[i] *= -1.0;
                 }
             }
-            cpgrid::DefaultGeometryPolicy gp(cellgeom, facegeom, pointgeom);
-            gpol = gp;
+            // The final, combined object. Moved rather than copied, to keep
+            // the cell corners referring to the point geometries valid.
+            gpol = cpgrid::DefaultGeometryPolicy(std::move(cellgeom), std::move(facegeom),
+                                                 std::move(pointgeom));
             normals.assign(face_normals.begin(), face_normals.end());
 #ifdef VERBOSE
             std::cout << "Final construction: " << clock.secsSinceLast() << std::endl;
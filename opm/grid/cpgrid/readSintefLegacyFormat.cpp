@@ -73,6 +73,7 @@ namespace Dune
             }
             readTopo(file, cell_to_face_, face_to_cell_, cell_to_point_);
         }
+        computeFaceCells();
         std::string geomfilename = grid_prefix + "-geom.dat";
         {
             std::ifstream file(geomfilename.c_str());
@@ -0,0 +1,322 @@
+//===========================================================================
+//
+// File: reorderForLocality.cpp
+//
+// Created: Mon Oct 19 2026
+//
+//===========================================================================
+
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <opm/grid/utility/ErrorMacros.hpp>
+#include "CpGridData.hpp"
+#include "PartitionTypeIndicator.hpp"
+
+namespace Dune
+{
+namespace cpgrid
+{
+
+namespace
+{
+/// \brief Compute a reverse Cuthill-McKee ordering of the cells.
+/// \param face_cells The flat face to cell array (-1 for missing cells).
+/// \param c2f The cell to face table.
+/// \return new2old[i] is the old index of the cell with new index i.
+std::vector<int> reverseCuthillMcKee(const std::vector<int>& face_cells,
+                                     const OrientedEntityTable<0, 1>& c2f)
+{
+    const int num_cells = c2f.size();
+    // Build the cell adjacency graph in compressed row format.
+    std::vector<int> adj_start(num_cells + 1, 0);
+    std::vector<int> adj;
+    adj.reserve(c2f.dataSize());
+    for (int c = 0; c < num_cells; ++c) {
+        for (const auto& face : c2f[EntityRep<0>(c, true)]) {
+            const int* cells = &face_cells[2*face.index()];
+            const int other = (cells[0] == c) ? cells[1] : cells[0];
+            if (other >= 0 && other != c) {
+                adj.push_back(other);
+            }
+        }
+        // Cells may share more than one face.
+        auto row_begin = adj.begin() + adj_start[c];
+        std::sort(row_begin, adj.end());
+        adj.erase(std::unique(row_begin, adj.end()), adj.end());
+        adj_start[c + 1] = adj.size();
+    }
+    auto degree = [&adj_start](int c) { return adj_start[c + 1] - adj_start[c]; };
+
+    // Start each connected component at an unvisited cell of minimum degree.
+    std::vector<int> by_degree(num_cells);
+    for (int c = 0; c < num_cells; ++c) {
+        by_degree[c] = c;
+    }
+    std::stable_sort(by_degree.begin(), by_degree.end(),
+                     [&degree](int a, int b) { return degree(a) < degree(b); });
+
+    std::vector<int> order;
+    order.reserve(num_cells);
+    std::vector<char> visited(num_cells, false);
+    std::vector<int> neighbours;
+    for (int start : by_degree) {
+        if (visited[start]) {
+            continue;
+        }
+        std::queue<int> queue;
+        queue.push(start);
+        visited[start] = true;
+        while (!queue.empty()) {
+            const int c = queue.front();
+            queue.pop();
+            order.push_back(c);
+            neighbours.clear();
+            for (int i = adj_start[c]; i < adj_start[c + 1]; ++i) {
+                if (!visited[adj[i]]) {
+                    neighbours.push_back(adj[i]);
+                    visited[adj[i]] = true;
+                }
+            }
+            std::stable_sort(neighbours.begin(), neighbours.end(),
+                             [&degree](int a, int b) { return degree(a) < degree(b); });
+            for (int n : neighbours) {
+                queue.push(n);
+            }
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+/// \brief Number entities in the order they are first encountered.
+///
+/// Entities never encountered are appended in their old order.
+class FirstTouchNumbering
+{
+public:
+    explicit FirstTouchNumbering(int size)
+        : old2new_(size, -1)
+    {
+        new2old_.reserve(size);
+    }
+    void touch(int old_index)
+    {
+        if (old2new_[old_index] < 0) {
+            old2new_[old_index] = new2old_.size();
+            new2old_.push_back(old_index);
+        }
+    }
+    void finish()
+    {
+        for (int i = 0, size = old2new_.size(); i < size; ++i) {
+            touch(i);
+        }
+    }
+    const std::vector<int>& old2new() const
+    {
+        return old2new_;
+    }
+    std::vector<int>& new2old()
+    {
+        return new2old_;
+    }
+private:
+    std::vector<int> old2new_;
+    std::vector<int> new2old_;
+};
+
+template<class T>
+std::vector<T> permuted(const std::vector<T>& values, const std::vector<int>& new2old)
+{
+    std::vector<T> result;
+    result.reserve(new2old.size());
+    for (int old_index : new2old) {
+        result.push_back(values[old_index]);
+    }
+    return result;
+}
+
+std::vector<int> inverse(const std::vector<int>& new2old)
+{
+    std::vector<int> old2new(new2old.size());
+    for (int i = 0, size = new2old.size(); i < size; ++i) {
+        old2new[new2old[i]] = i;
+    }
+    return old2new;
+}
+} // end anonymous namespace
+
+
+
+void CpGridData::reorderForLocality()
+{
+    if (!partition_type_indicator_->cell_indicator_.empty()) {
+        OPM_THROW(std::logic_error, "Only the global grid can be reordered for locality.");
+    }
+    const int num_cells = size(0);
+    const int num_faces = face_to_cell_.size();
+    const int num_points = geomVector<3>().size();
+
+    // Cells in reverse Cuthill-McKee order, faces and points
+    // in the order they are first reached from those cells.
+    std::vector<int> cell_new2old = reverseCuthillMcKee(face_cells_, cell_to_face_);
+    const std::vector<int> cell_old2new = inverse(cell_new2old);
+    FirstTouchNumbering faces(num_faces);
+    for (int old_cell : cell_new2old) {
+        for (const auto& face : cell_to_face_[EntityRep<0>(old_cell, true)]) {
+            faces.touch(face.index());
+        }
+    }
+    faces.finish();
+    FirstTouchNumbering points(num_points);
+    for (int old_face : faces.new2old()) {
+        for (int point : face_to_point_[old_face]) {
+            points.touch(point);
+        }
+    }
+    for (int old_cell : cell_new2old) {
+        for (int point : cell_to_point_[old_cell]) {
+            points.touch(point);
+        }
+    }
+    points.finish();
+    const std::vector<int>& face_old2new = faces.old2new();
+    const std::vector<int>& point_old2new = points.old2new();
+
+    // Topology.
+    {
+        const Opm::SparseTable<EntityRep<1> >& old_c2f = cell_to_face_;
+        Opm::SparseTable<EntityRep<1> > c2f;
+        c2f.reserve(num_cells, old_c2f.dataSize());
+        std::vector<EntityRep<1> > row;
+        for (int old_cell : cell_new2old) {
+            row.assign(old_c2f[old_cell].begin(), old_c2f[old_cell].end());
+            for (auto& face : row) {
+                face.setValue(face_old2new[face.index()], face.orientation());
+            }
+            c2f.appendRow(row.begin(), row.end());
+        }
+        static_cast<Opm::SparseTable<EntityRep<1> >&>(cell_to_face_).swap(c2f);
+    }
+    {
+        const Opm::SparseTable<EntityRep<0> >& old_f2c = face_to_cell_;
+        Opm::SparseTable<EntityRep<0> > f2c;
+        f2c.reserve(num_faces, old_f2c.dataSize());
+        std::vector<EntityRep<0> > row;
+        for (int old_face : faces.new2old()) {
+            row.assign(old_f2c[old_face].begin(), old_f2c[old_face].end());
+            // The orientation is unchanged, hence the rows stay sorted.
+            for (auto& cell : row) {
+                cell.setValue(cell_old2new[cell.index()], cell.orientation());
+            }
+            f2c.appendRow(row.begin(), row.end());
+        }
+        static_cast<Opm::SparseTable<EntityRep<0> >&>(face_to_cell_).swap(f2c);
+    }
+    {
+        Opm::SparseTable<int> f2p;
+        f2p.reserve(num_faces, face_to_point_.dataSize());
+        std::vector<int> row;
+        for (int old_face : faces.new2old()) {
+            row.assign(face_to_point_[old_face].begin(), face_to_point_[old_face].end());
+            for (auto& point : row) {
+                point = point_old2new[point];
+            }
+            f2p.appendRow(row.begin(), row.end());
+        }
+        face_to_point_.swap(f2p);
+    }
+    cell_to_point_ = permuted(cell_to_point_, cell_new2old);
+    for (auto& corners : cell_to_point_) {
+        for (auto& point : corners) {
+            point = point_old2new[point];
+        }
+    }
+    global_cell_ = permuted(global_cell_, cell_new2old);
+
+    // Face data.
+    auto tags = permuted(static_cast<const std::vector<enum face_tag>&>(face_tag_), faces.new2old());
+    face_tag_.assign(tags.begin(), tags.end());
+    auto normals = permuted(static_cast<const std::vector<PointType>&>(face_normals_), faces.new2old());
+    face_normals_.assign(normals.begin(), normals.end());
+    if (!unique_boundary_ids_.empty()) {
+        auto ids = permuted(static_cast<const std::vector<int>&>(unique_boundary_ids_), faces.new2old());
+        unique_boundary_ids_.assign(ids.begin(), ids.end());
+    }
+
+    // Geometry. The cell geometries point into the point geometries
+    // and cell_to_point_ and therefore need to be recreated.
+    EntityVariable<Geometry<0, 3>, 3> point_geom;
+    auto tmp_point_geom = permuted(static_cast<const std::vector<Geometry<0, 3> >&>(geomVector<3>()),
+                                   points.new2old());
+    point_geom.assign(tmp_point_geom.begin(), tmp_point_geom.end());
+    const auto& old_cell_geom = static_cast<const std::vector<Geometry<3, 3> >&>(geomVector<0>());
+    std::vector<Geometry<3, 3> > tmp_cell_geom;
+    tmp_cell_geom.reserve(num_cells);
+    for (int c = 0; c < num_cells; ++c) {
+        const auto& geom = old_cell_geom[cell_new2old[c]];
+        if (geom.hasCorners()) {
+            tmp_cell_geom.push_back(Geometry<3, 3>(geom.center(), geom.volume(),
+                                                   &point_geom.get(0), cell_to_point_[c].data()));
+        } else {
+            tmp_cell_geom.push_back(Geometry<3, 3>(geom.center(), geom.volume()));
+        }
+    }
+    EntityVariable<Geometry<3, 3>, 0> cell_geom;
+    cell_geom.assign(tmp_cell_geom.begin(), tmp_cell_geom.end());
+    EntityVariable<Geometry<2, 3>, 1> face_geom;
+    auto tmp_face_geom = permuted(static_cast<const std::vector<Geometry<2, 3> >&>(geomVector<1>()),
+                                  faces.new2old());
+    face_geom.assign(tmp_face_geom.begin(), tmp_face_geom.end());
+    geometry_ = DefaultGeometryPolicy(std::move(cell_geom), std::move(face_geom), std::move(point_geom));
+
+    computeFaceCells();
+
+    // Remember the original numbering, composed with that of a previous reordering.
+    if (!original_index_[0].empty()) {
+        cell_new2old = permuted(original_index_[0], cell_new2old);
+        faces.new2old() = permuted(original_index_[1], faces.new2old());
+        points.new2old() = permuted(original_index_[2], points.new2old());
+    }
+    original_index_[0].swap(cell_new2old);
+    original_index_[1].swap(faces.new2old());
+    original_index_[2].swap(points.new2old());
+}
+
+const std::vector<int>& CpGridData::originalIndices(int codim) const
+{
+    switch (codim) {
+    case 0: return original_index_[0];
+    case 1: return original_index_[1];
+    case 3: return original_index_[2];
+    default:
+        OPM_THROW(std::logic_error, "Original indices are only available for codims 0, 1 and 3, not " << codim);
+    }
+}
+
+} // end namespace cpgrid
+} // end namespace Dune
@@ -0,0 +1,271 @@
+/*
+  This file is part of The Open Porous Media project  (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <algorithm>
+#include <vector>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/utility/ErrorMacros.hpp>
+#include "CpGridData.hpp"
+#include "UnstructuredGridView.hpp"
+
+namespace Dune
+{
+
+    namespace
+    {
+        typedef FieldVector<double, 3> point_t;
+
+        /// The data of a vector as the non-const pointer of an
+        /// UnstructuredGrid, null if the vector is empty.
+        template <class T>
+        T* sharedArray(const std::vector<T>& v)
+        {
+            return v.empty() ? nullptr : const_cast<T*>(v.data());
+        }
+
+        point_t point(const double* p)
+        {
+            return point_t{ p[0], p[1], p[2] };
+        }
+    } // anon namespace
+
+
+
+    cpgrid::UnstructuredGridView::UnstructuredGridView(const CpGrid& grid)
+        : grid_()
+    {
+        grid.fillUnstructuredGridView(*this);
+    }
+
+
+
+    /// Describe this view as an UnstructuredGrid.
+    void cpgrid::CpGridData::fillUnstructuredGridView(UnstructuredGridView& view) const
+    {
+        const int num_cells = size(0);
+        const int num_faces = face_to_cell_.size();
+        const int num_points = size(3);
+        UnstructuredGrid& g = view.grid_;
+        g.dimensions = 3;
+        g.number_of_cells = num_cells;
+        g.number_of_faces = num_faces;
+        g.number_of_nodes = num_points;
+        std::copy(logical_cartesian_size_.begin(), logical_cartesian_size_.end(), g.cartdims);
+
+        // Shared topology. face_cells_ has the layout and orientation of
+        // UnstructuredGrid::face_cells.
+        const Opm::SparseTable<EntityRep<1> >& c2f = cell_to_face_;
+        g.face_nodes = num_faces == 0 ? nullptr : const_cast<int*>(face_to_point_[0].begin());
+        g.face_nodepos = sharedArray(face_to_point_.rowStarts());
+        g.face_cells = sharedArray(face_cells_);
+        g.cell_facepos = sharedArray(c2f.rowStarts());
+        g.global_cell = sharedArray(global_cell_);
+        g.zcorn = sharedArray(zcorn);
+
+        // The cell faces hold the orientation, which is positive if the
+        // cell is the first of the face, i.e. the normal points outwards.
+        const bool has_tags = int(face_tag_.size()) == num_faces;
+        view.cell_faces_.resize(c2f.dataSize());
+        view.cell_facetag_.resize(has_tags ? c2f.dataSize() : 0);
+        for (int i = 0; i < c2f.dataSize(); ++i) {
+            const EntityRep<1> face = c2f.data(i);
+            view.cell_faces_[i] = face.index();
+            if (has_tags) {
+                view.cell_facetag_[i] = 2 * face_tag_.get(face.index()) + (face.orientation() ? 1 : 0);
+            }
+        }
+        g.cell_faces = sharedArray(view.cell_faces_);
+        g.cell_facetag = sharedArray(view.cell_facetag_);
+
+        // Shared geometry. The point geometries consist of their position only.
+        const std::vector<cpgrid::Geometry<0, 3> >& point_geom = geometry_.geomVector<3>();
+        if (sizeof(cpgrid::Geometry<0, 3>) == 3 * sizeof(double) && !point_geom.empty()) {
+            g.node_coordinates = const_cast<double*>(&point_geom[0].center()[0]);
+        } else {
+            view.node_coordinates_.clear();
+            view.node_coordinates_.reserve(3 * num_points);
+            for (const auto& p : point_geom) {
+                view.node_coordinates_.insert(view.node_coordinates_.end(),
+                                              p.center().begin(), p.center().end());
+            }
+            g.node_coordinates = sharedArray(view.node_coordinates_);
+        }
+        // CpGrid has unit normals, UnstructuredGrid area weighted ones.
+        const std::vector<cpgrid::Geometry<2, 3> >& face_geom = geometry_.geomVector<1>();
+        const std::vector<PointType>& normals = face_normals_;
+        view.face_centroids_.resize(3 * num_faces);
+        view.face_normals_.resize(3 * num_faces);
+        view.face_areas_.resize(num_faces);
+        for (int face = 0; face < num_faces; ++face) {
+            const double area = face_geom[face].volume();
+            view.face_areas_[face] = area;
+            for (int d = 0; d < 3; ++d) {
+                view.face_centroids_[3*face + d] = face_geom[face].center()[d];
+                view.face_normals_[3*face + d] = normals[face][d] * area;
+            }
+        }
+        const std::vector<cpgrid::Geometry<3, 3> >& cell_geom = geometry_.geomVector<0>();
+        view.cell_centroids_.resize(3 * num_cells);
+        view.cell_volumes_.resize(num_cells);
+        for (int c = 0; c < num_cells; ++c) {
+            view.cell_volumes_[c] = cell_geom[c].volume();
+            for (int d = 0; d < 3; ++d) {
+                view.cell_centroids_[3*c + d] = cell_geom[c].center()[d];
+            }
+        }
+        g.face_centroids = sharedArray(view.face_centroids_);
+        g.face_normals = sharedArray(view.face_normals_);
+        g.face_areas = sharedArray(view.face_areas_);
+        g.cell_centroids = sharedArray(view.cell_centroids_);
+        g.cell_volumes = sharedArray(view.cell_volumes_);
+    }
+
+
+
+    /// Build this view from an UnstructuredGrid of a corner-point grid.
+    void cpgrid::CpGridData::processUnstructuredGrid(const UnstructuredGrid& grid)
+    {
+        if (grid.dimensions != 3 || grid.cell_facetag == nullptr) {
+            OPM_THROW(std::runtime_error, "Only three-dimensional grids with cell face tags, "
+                      "e.g. of create_grid_cornerpoint(), can be converted to a CpGrid.");
+        }
+        PhaseTimings::Scope topology_timer(phase_timings_, GridPhase::Topology);
+
+        // Faces without cells are dropped, as by processEclipseFormat().
+        const int* fc = grid.face_cells;
+        std::vector<int> face_to_input_face;
+        std::vector<int> input_face_to_face(grid.number_of_faces, -1);
+        face_to_cell_.clear();
+        for (int f = 0; f < grid.number_of_faces; ++f) {
+            EntityRep<0> cells[2];
+            int cellcount = 0;
+            if (fc[2*f] != -1) {
+                cells[cellcount++].setValue(fc[2*f], true);
+            }
+            if (fc[2*f + 1] != -1) {
+                cells[cellcount++].setValue(fc[2*f + 1], false);
+            }
+            if (cellcount > 0) {
+                std::sort(cells, cells + cellcount);
+                face_to_cell_.appendRow(cells, cells + cellcount);
+                input_face_to_face[f] = face_to_input_face.size();
+                face_to_input_face.push_back(f);
+            }
+        }
+        const int num_faces = face_to_input_face.size();
+        const int num_cells = grid.number_of_cells;
+        const int num_points = grid.number_of_nodes;
+        face_to_cell_.makeInverseRelation(cell_to_face_);
+        computeFaceCells();
+        std::copy(grid.cartdims, grid.cartdims + 3, logical_cartesian_size_.begin());
+        global_cell_.resize(num_cells);
+        for (int c = 0; c < num_cells; ++c) {
+            global_cell_[c] = grid.global_cell != nullptr ? grid.global_cell[c] : c;
+        }
+
+        face_to_point_.clear();
+        for (int face = 0; face < num_faces; ++face) {
+            const int f = face_to_input_face[face];
+            face_to_point_.appendRow(grid.face_nodes + grid.face_nodepos[f],
+                                     grid.face_nodes + grid.face_nodepos[f + 1]);
+        }
+
+        // The face tags and the corners, which are the nodes of the bottom
+        // and top faces in 'x fastest, then y, then z' order.
+        std::vector<enum face_tag> face_tags(num_faces, LEFT);
+        cell_to_point_.resize(num_cells);
+        for (int c = 0; c < num_cells; ++c) {
+            int bottom = -1, top = -1;
+            for (int hf = grid.cell_facepos[c]; hf < grid.cell_facepos[c + 1]; ++hf) {
+                const int f = grid.cell_faces[hf];
+                const int tag = grid.cell_facetag[hf];
+                face_tags[input_face_to_face[f]] = static_cast<enum face_tag>(tag / 2);
+                if (tag == 4) {
+                    bottom = f;
+                } else if (tag == 5) {
+                    top = f;
+                }
+            }
+            if (bottom < 0 || top < 0
+                || grid.face_nodepos[bottom + 1] - grid.face_nodepos[bottom] != 4
+                || grid.face_nodepos[top + 1] - grid.face_nodepos[top] != 4) {
+                OPM_THROW(std::runtime_error, "Cell " << c << " has no quadrilateral bottom and top faces.");
+            }
+            const int* b = grid.face_nodes + grid.face_nodepos[bottom];
+            const int* t = grid.face_nodes + grid.face_nodepos[top];
+            cell_to_point_[c] = {{ b[0], b[1], b[3], b[2], t[0], t[1], t[3], t[2] }};
+        }
+        face_tag_.assign(face_tags.begin(), face_tags.end());
+        topology_timer.stop();
+
+        // Geometry, with the cell corners referring to the point geometries.
+        PhaseTimings::Scope geometry_timer(phase_timings_, GridPhase::Geometry);
+        std::vector<cpgrid::Geometry<0, 3> > pg;
+        pg.reserve(num_points);
+        for (int i = 0; i < num_points; ++i) {
+            pg.emplace_back(point(grid.node_coordinates + 3*i));
+        }
+        EntityVariable<cpgrid::Geometry<0, 3>, 3> pointgeom;
+        pointgeom.assign(pg.begin(), pg.end());
+        std::vector<cpgrid::Geometry<3, 3> > cg;
+        cg.reserve(num_cells);
+        const cpgrid::Geometry<0, 3>* allcorners = pointgeom.empty() ? 0 : &pointgeom.get(0);
+        for (int c = 0; c < num_cells; ++c) {
+            cg.emplace_back(point(grid.cell_centroids + 3*c), grid.cell_volumes[c],
+                            allcorners, &cell_to_point_[c][0]);
+        }
+        EntityVariable<cpgrid::Geometry<3, 3>, 0> cellgeom;
+        cellgeom.assign(cg.begin(), cg.end());
+        std::vector<cpgrid::Geometry<2, 3> > fg;
+        std::vector<point_t> normals;
+        fg.reserve(num_faces);
+        normals.reserve(num_faces);
+        for (int face = 0; face < num_faces; ++face) {
+            const int f = face_to_input_face[face];
+            const double area = grid.face_areas[f];
+            fg.emplace_back(point(grid.face_centroids + 3*f), area);
+            // UnstructuredGrid has area weighted normals, CpGrid unit ones.
+            point_t normal = point(grid.face_normals + 3*f);
+            if (area > 0.0) {
+                normal /= area;
+            }
+            normals.push_back(normal);
+        }
+        EntityVariable<cpgrid::Geometry<2, 3>, 1> facegeom;
+        facegeom.assign(fg.begin(), fg.end());
+        // Moved rather than copied, to keep the cell corners valid.
+        geometry_ = cpgrid::DefaultGeometryPolicy(std::move(cellgeom), std::move(facegeom),
+                                                  std::move(pointgeom));
+        face_normals_.assign(normals.begin(), normals.end());
+        geometry_timer.stop();
+
+        if (grid.zcorn != nullptr) {
+            const std::size_t num_zcorn = 8 * std::size_t(logical_cartesian_size_[0])
+                * logical_cartesian_size_[1] * logical_cartesian_size_[2];
+            zcorn.assign(grid.zcorn, grid.zcorn + num_zcorn);
+        }
+
+        computeUniqueBoundaryIds();
+    }
+
+} // namespace Dune
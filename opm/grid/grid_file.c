@@ -0,0 +1,319 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+#include <opm/grid/grid_file.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+#define GRID_FILE_ALIGNMENT  64
+#define GRID_FILE_BYTE_ORDER 0x01020304u
+
+static const char grid_file_magic[8] = { 'O', 'P', 'M', 'G', 'R', 'I', 'D', 0 };
+
+/* On-disk header, 64 bytes. */
+struct grid_file_header {
+    char     magic[8];
+    uint32_t byte_order;
+    uint32_t version;
+    char     kind[16];
+    uint64_t num_sections;
+    uint64_t table_offset;
+    uint64_t table_checksum;
+    char     reserved[8];
+};
+
+/* On-disk section table entry, 64 bytes. */
+struct grid_file_entry {
+    char     name[16];
+    uint32_t type;
+    uint32_t element_size;
+    uint64_t offset;
+    uint64_t count;
+    uint64_t checksum;
+    char     reserved[16];
+};
+
+struct grid_file {
+    const unsigned char          *map;
+    size_t                        size;
+    const struct grid_file_entry *table;
+    size_t                        num_sections;
+    unsigned char                *verified;    /* Checksum of section i matched. */
+};
+
+
+/* 64 bit FNV-1a hash. */
+static uint64_t
+checksum(const void *data, size_t size)
+{
+    const unsigned char *bytes = data;
+    uint64_t             hash  = 14695981039346656037ULL;
+    size_t               i;
+
+    for (i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+
+static size_t
+element_size(enum grid_file_type type)
+{
+    return (type == GRID_FILE_INT32) ? sizeof(int32_t) : sizeof(double);
+}
+
+
+static uint64_t
+align(uint64_t offset)
+{
+    return (offset + GRID_FILE_ALIGNMENT - 1) / GRID_FILE_ALIGNMENT * GRID_FILE_ALIGNMENT;
+}
+
+
+static int
+write_padding(FILE *fp, uint64_t *pos, uint64_t target)
+{
+    static const char zeros[GRID_FILE_ALIGNMENT] = { 0 };
+    size_t n = (size_t) (target - *pos);
+
+    *pos = target;
+
+    return (n == 0) || (fwrite(zeros, 1, n, fp) == n);
+}
+
+
+int
+write_grid_file(const char                     *fname,
+                const char                     *kind,
+                const struct grid_file_section *sections,
+                size_t                          num_sections)
+{
+    struct grid_file_header  header;
+    struct grid_file_entry  *table;
+    FILE                    *fp;
+    uint64_t                 offset, pos;
+    size_t                   i, nbytes;
+    int                      ok;
+
+    table = calloc(num_sections > 0 ? num_sections : 1, sizeof *table);
+    if (table == NULL) {
+        return 0;
+    }
+
+    offset = align(sizeof header + num_sections * sizeof *table);
+    for (i = 0; i < num_sections; ++i) {
+        nbytes = sections[i].count * element_size(sections[i].type);
+
+        strncpy(table[i].name, sections[i].name, GRID_FILE_NAME_LENGTH);
+        table[i].type         = sections[i].type;
+        table[i].element_size = (uint32_t) element_size(sections[i].type);
+        table[i].offset       = offset;
+        table[i].count        = sections[i].count;
+        table[i].checksum     = checksum(sections[i].data, nbytes);
+
+        offset = align(offset + nbytes);
+    }
+
+    memset(&header, 0, sizeof header);
+    memcpy(header.magic, grid_file_magic, sizeof header.magic);
+    header.byte_order     = GRID_FILE_BYTE_ORDER;
+    header.version        = GRID_FILE_VERSION;
+    strncpy(header.kind, kind, sizeof header.kind - 1);
+    header.num_sections   = num_sections;
+    header.table_offset   = sizeof header;
+    header.table_checksum = checksum(table, num_sections * sizeof *table);
+
+    fp = fopen(fname, "wb");
+    ok = fp != NULL;
+
+    if (ok) {
+        ok = (fwrite(&header, sizeof header, 1, fp) == 1) &&
+             ((num_sections == 0) ||
+              (fwrite(table, sizeof *table, num_sections, fp) == num_sections));
+
+        pos = sizeof header + num_sections * sizeof *table;
+        for (i = 0; ok && (i < num_sections); ++i) {
+            nbytes = sections[i].count * element_size(sections[i].type);
+
+            ok = write_padding(fp, &pos, table[i].offset) &&
+                 ((nbytes == 0) || (fwrite(sections[i].data, 1, nbytes, fp) == nbytes));
+            pos += nbytes;
+        }
+
+        ok = (fclose(fp) == 0) && ok;
+    }
+
+    free(table);
+
+    return ok;
+}
+
+
+struct grid_file *
+open_grid_file(const char *fname, const char *kind)
+{
+    const struct grid_file_header *header;
+    struct grid_file              *f;
+    struct stat                    st;
+    void                          *map;
+    size_t                         i, table_size;
+    int                            fd, ok;
+
+    fd = open(fname, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    ok  = (fstat(fd, &st) == 0) &&
+          ((size_t) st.st_size >= sizeof(struct grid_file_header));
+    map = ok ? mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+
+    if (map == MAP_FAILED) {
+        return NULL;
+    }
+
+    f = malloc(sizeof *f);
+    ok = f != NULL;
+
+    if (ok) {
+        f->map      = map;
+        f->size     = st.st_size;
+        f->verified = NULL;
+
+        header = map;
+        ok = (memcmp(header->magic, grid_file_magic, sizeof header->magic) == 0) &&
+             (header->byte_order == GRID_FILE_BYTE_ORDER) &&
+             (header->version <= GRID_FILE_VERSION) &&
+             (strncmp(header->kind, kind, sizeof header->kind) == 0) &&
+             (header->table_offset <= f->size) &&
+             (header->num_sections <=
+              (f->size - header->table_offset) / sizeof(struct grid_file_entry));
+    }
+
+    if (ok) {
+        f->num_sections = header->num_sections;
+        f->table        = (const struct grid_file_entry *) (f->map + header->table_offset);
+        table_size      = f->num_sections * sizeof *f->table;
+
+        ok = checksum(f->table, table_size) == header->table_checksum;
+
+        if (ok) {
+            f->verified = calloc(f->num_sections > 0 ? f->num_sections : 1,
+                                 sizeof *f->verified);
+            ok = f->verified != NULL;
+        }
+
+        for (i = 0; ok && (i < f->num_sections); ++i) {
+            ok = (f->table[i].offset <= f->size) &&
+                 (f->table[i].element_size > 0) &&
+                 (f->table[i].count <=
+                  (f->size - f->table[i].offset) / f->table[i].element_size);
+        }
+    }
+
+    if (! ok) {
+        munmap(map, st.st_size);
+        if (f != NULL) {
+            free(f->verified);
+        }
+        free(f);
+        f = NULL;
+    }
+
+    return f;
+}
+
+
+static const struct grid_file_entry *
+find_section(const struct grid_file *f, const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < f->num_sections; ++i) {
+        if (strncmp(f->table[i].name, name, sizeof f->table[i].name) == 0) {
+            return &f->table[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+int
+grid_file_has_section(const struct grid_file *f, const char *name)
+{
+    return find_section(f, name) != NULL;
+}
+
+
+const void *
+grid_file_section(const struct grid_file *f,
+                  const char             *name,
+                  enum grid_file_type     type,
+                  size_t                 *count)
+{
+    const struct grid_file_entry *e;
+    const void                   *data;
+
+    e = find_section(f, name);
+    if ((e == NULL) ||
+        (e->type != (uint32_t) type) ||
+        (e->element_size != element_size(type))) {
+        return NULL;
+    }
+
+    /* Verify each section once, later calls only touch the pages used. */
+    data = f->map + e->offset;
+    if (! f->verified[e - f->table]) {
+        if (checksum(data, e->count * e->element_size) != e->checksum) {
+            return NULL;
+        }
+        f->verified[e - f->table] = 1;
+    }
+
+    if (count != NULL) {
+        *count = e->count;
+    }
+
+    return data;
+}
+
+
+void
+close_grid_file(struct grid_file *f)
+{
+    if (f != NULL) {
+        munmap((void *) f->map, f->size);
+        free(f->verified);
+    }
+
+    free(f);
+}
@@ -0,0 +1,133 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_GRID_FILE_H_HEADER
+#define OPM_GRID_FILE_H_HEADER
+
+#include <stddef.h>
+
+/**
+ * \file
+ *
+ * Binary container for grid arrays.
+ *
+ * A grid file consists of a 64 byte header, a table of sections and the
+ * data of the sections.  The header holds a magic string, a byte order
+ * tag, the format version and the kind of grid stored.  Each entry of the
+ * table holds the name, element type, offset, number of elements and an
+ * FNV-1a checksum of one section.  The data of each section starts at an
+ * offset that is a multiple of 64 bytes and is stored in the byte order
+ * of the writing machine, so the arrays can be used directly from a
+ * memory mapping of the file.  Files written on a machine with a
+ * different byte order are rejected.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Current version of the grid file format. */
+#define GRID_FILE_VERSION 1
+
+/** Maximum length of a section name, excluding the terminating zero. */
+#define GRID_FILE_NAME_LENGTH 15
+
+/** Element types of sections. */
+enum grid_file_type { GRID_FILE_INT32 = 1, GRID_FILE_FLOAT64 = 2 };
+
+/** One array to write to a grid file. */
+struct grid_file_section {
+    const char          *name;  /**< Unique name of the section. */
+    enum grid_file_type  type;  /**< Element type. */
+    size_t               count; /**< Number of elements. */
+    const void          *data;  /**< The elements. */
+};
+
+/** A grid file opened for reading, see open_grid_file(). */
+struct grid_file;
+
+/**
+ * Write a grid file.
+ *
+ * @param[in] fname        File name.
+ * @param[in] kind         Kind of grid, at most 15 characters.
+ * @param[in] sections     Sections to write.
+ * @param[in] num_sections Number of sections.
+ * @return Non-zero on success, zero on failure.
+ */
+int
+write_grid_file(const char                     *fname,
+                const char                     *kind,
+                const struct grid_file_section *sections,
+                size_t                          num_sections);
+
+/**
+ * Map a grid file into memory.
+ *
+ * @param[in] fname File name.
+ * @param[in] kind  Kind of grid the file must contain.
+ * @return The opened file.  @c NULL if the file cannot be mapped, is not a
+ * grid file of the given kind, has an unknown version, a different byte
+ * order or an inconsistent section table.
+ */
+struct grid_file *
+open_grid_file(const char *fname, const char *kind);
+
+/**
+ * Check whether a grid file has a section, without verifying its data.
+ *
+ * @param[in] f    Grid file.
+ * @param[in] name Name of the section.
+ * @return Non-zero if the section exists, zero otherwise.
+ */
+int
+grid_file_has_section(const struct grid_file *f, const char *name);
+
+/**
+ * Access the data of a section without copying it.
+ *
+ * Only the pages of the file holding the section are read.  The checksum
+ * of the section is verified on the first access only, so repeated calls
+ * are cheap.  Concurrent calls on the same file must be synchronised.
+ *
+ * @param[in]  f     Grid file.
+ * @param[in]  name  Name of the section.
+ * @param[in]  type  Expected element type.
+ * @param[out] count Number of elements.  May be @c NULL.
+ * @return Pointer to the first element, valid until close_grid_file().
+ * @c NULL if the section does not exist, has a different type or a
+ * wrong checksum.
+ */
+const void *
+grid_file_section(const struct grid_file *f,
+                  const char             *name,
+                  enum grid_file_type     type,
+                  size_t                 *count);
+
+/**
+ * Unmap a grid file and release its resources.
+ *
+ * @param[in,out] f Grid file.  May be @c NULL.
+ */
+void
+close_grid_file(struct grid_file *f);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPM_GRID_FILE_H_HEADER */
@@ -44,7 +44,7 @@ namespace Dune
     template< int dim, int dimworld >
     struct isParallel< PolyhedralGrid< dim, dimworld > >
     {
-        static const bool v = false;
+        static const bool v = true;
     };
 #endif
 
@@ -52,7 +52,7 @@ namespace Dune
     template< int dim, int dimworld, int codim >
     struct canCommunicate< PolyhedralGrid< dim, dimworld >, codim >
     {
-        static const bool v = false;
+        static const bool v = (codim == 0);
     };
 
 
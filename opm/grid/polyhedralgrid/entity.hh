@@ -109,7 +109,7 @@ namespace Dune
     /** \brief obtain the partition type of this entity */
     PartitionType partitionType () const
     {
-      return InteriorEntity; // data()->partitionType( *this );
+      return data()->partitionType( seed_ );
     }
 
     /** obtain the geometry of this entity */
@@ -105,7 +105,6 @@ namespace Dune
         GlobalCoordinate xyz(0.0);
         for (int i = 0; i < nCorners ; ++i)
         {
-          GlobalCoordinate cornerContrib = corner(i);
           //LocalCoordinate  refCorner = refElement.position(i,mydimension);
           double factor = 1.0;
           for (int j = 0; j < mydimension; ++j)
@@ -113,8 +112,8 @@ namespace Dune
             //factor *= uvw[ refCorner[ j ] ][ j ];
             factor *= uvw[ pat[ i ][ j ] ][ j ];
           }
-          cornerContrib *= factor;
-          xyz += cornerContrib;
+          // corner of the grid's cache, no copy
+          xyz.axpy( factor, data()->corner( seed_, i ) );
         }
         return xyz;
       }
@@ -4,6 +4,8 @@
 #define DUNE_POLYHEDRALGRID_GRID_HH
 
 #include <array>
+#include <map>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -16,6 +18,10 @@
 //- dune-grid includes
 #include <dune/grid/common/grid.hh>
 #include <dune/common/parallel/collectivecommunication.hh>
+#include <dune/common/parallel/mpihelper.hh>
+#if HAVE_MPI
+#include <dune/common/parallel/variablesizecommunicator.hh>
+#endif
 
 //- polyhedralgrid includes
 #include <opm/grid/polyhedralgrid/capabilities.hh>
@@ -35,6 +41,8 @@
 #include <opm/grid/GridManager.hpp>
 #include <opm/grid/cornerpoint_grid.h>
 #include <opm/grid/MinpvProcessor.hpp>
+#include <opm/grid/common/UnstructuredGridDistribution.hpp>
+#include <opm/grid/cpgrid/UnstructuredGridView.hpp>
 
 namespace Dune
 {
@@ -125,7 +133,7 @@ namespace Dune
       typedef PolyhedralGridIdSet< dim, dimworld, ctype > GlobalIdSet;
       typedef GlobalIdSet  LocalIdSet;
 
-      typedef Dune::CollectiveCommunication< Grid > CollectiveCommunication;
+      typedef Dune::CollectiveCommunication< MPIHelper::MPICommunicator > CollectiveCommunication;
 
       template< PartitionIteratorType pitype >
       struct Partition
@@ -173,6 +181,8 @@ namespace Dune
         destroy_grid( grdPtr );
       }
     };
+
+    typedef std::unique_ptr< UnstructuredGridType, UnstructuredGridDeleter > UnstructuredGridPtr;
   public:
     /** \cond */
     typedef PolyhedralGridFamily< dim, dimworld, coord_t > GridFamily;
@@ -303,12 +313,13 @@ namespace Dune
     explicit PolyhedralGrid ( const Opm::Deck& deck,
                               const  std::vector<double>& poreVolumes = std::vector<double> ())
     : gridPtr_( createGrid( deck, poreVolumes ) ),
-      grid_( *gridPtr_ ),
-      comm_( *this ),
+      grid_( gridPtr_.get() ),
+      comm_( MPIHelper::getLocalCommunicator() ),
       leafIndexSet_( *this ),
       globalIdSet_( *this ),
       localIdSet_( *this )
     {
+      numOwnedCells_ = size( 0 );
       init();
     }
 #endif
@@ -322,12 +333,35 @@ namespace Dune
      */
     explicit PolyhedralGrid ( const UnstructuredGridType& grid )
     : gridPtr_(),
-      grid_( grid ),
-      comm_( *this ),
+      grid_( &grid ),
+      comm_( MPIHelper::getLocalCommunicator() ),
+      leafIndexSet_( *this ),
+      globalIdSet_( *this ),
+      localIdSet_( *this )
+    {
+      numOwnedCells_ = size( 0 );
+      init();
+    }
+
+    /** \brief constructor
+     *
+     *  The grid shares the topology and geometry arrays of the current
+     *  view of the CpGrid, so no corner-point processing is done.
+     *  Therefore, the CpGrid must remain valid and its current view must
+     *  not change until this grid is destroyed.
+     *
+     *  \param[in]  grid  CpGrid reference
+     */
+    explicit PolyhedralGrid ( const Dune::CpGrid& grid )
+    : gridPtr_(),
+      cpgridView_( std::make_shared< cpgrid::UnstructuredGridView >( grid ) ),
+      grid_( &cpgridView_->grid() ),
+      comm_( MPIHelper::getLocalCommunicator() ),
       leafIndexSet_( *this ),
       globalIdSet_( *this ),
       localIdSet_( *this )
     {
+      numOwnedCells_ = size( 0 );
       init();
     }
 
@@ -335,7 +369,7 @@ namespace Dune
 
     /** \name Casting operators
      *  \{ */
-    operator const UnstructuredGridType& () const { return grid_; }
+    operator const UnstructuredGridType& () const { return *grid_; }
 
     /** \} */
 
@@ -377,15 +411,15 @@ namespace Dune
     {
       if( codim == 0 )
       {
-        return grid_.number_of_cells;
+        return grid_->number_of_cells;
       }
       else if ( codim == 1 )
       {
-        return grid_.number_of_faces;
+        return grid_->number_of_faces;
       }
       else if ( codim == dim )
       {
-        return grid_.number_of_nodes;
+        return grid_->number_of_nodes;
       }
       else
       {
@@ -550,9 +584,9 @@ namespace Dune
      *
      *  \param[in]  codim  codimension for with the information is desired
      */
-    int overlapSize ( int /* codim */) const
+    int overlapSize ( int codim ) const
     {
-      return 0;
+      return ( codim == 0 && comm_.size() > 1 ) ? 1 : 0;
     }
 
     /** \brief obtain size of ghost region for the leaf grid
@@ -569,9 +603,9 @@ namespace Dune
      *  \param[in]  level  grid level (0, ..., maxLevel())
      *  \param[in]  codim  codimension (0, ..., dimension)
      */
-    int overlapSize ( int /* level */, int /* codim */ ) const
+    int overlapSize ( int /* level */, int codim ) const
     {
-      return 0;
+      return overlapSize( codim );
     }
 
     /** \brief obtain size of ghost region for a grid level
@@ -598,12 +632,12 @@ namespace Dune
      *  \param[in]  level       grid level to communicate
      */
     template< class DataHandle, class Data >
-    void communicate ( CommDataHandleIF< DataHandle, Data >& /* dataHandle */,
-                       InterfaceType /* interface */,
-                       CommunicationDirection /* direction */,
+    void communicate ( CommDataHandleIF< DataHandle, Data >& dataHandle,
+                       InterfaceType interface,
+                       CommunicationDirection direction,
                        int /* level */ ) const
     {
-       //levelGridView( level ).communicate( dataHandle, interface, direction );
+      communicate( dataHandle, interface, direction );
     }
 
     /** \brief communicate information on leaf entities
@@ -617,13 +651,49 @@ namespace Dune
      *                          All_All_Interface)
      *  \param[in]  direction   communication direction (one of
      *                          ForwardCommunication, BackwardCommunication)
+     *
+     *  Only data of cells is communicated, as for CpGrid. There are no
+     *  border cells, so InteriorBorder_InteriorBorder_Interface is empty,
+     *  InteriorBorder_All_Interface copies from owner to overlap cells,
+     *  and the overlap interfaces exchange between all copies of a cell.
      */
     template< class DataHandle, class Data >
-    void communicate ( CommDataHandleIF< DataHandle, Data >& /* dataHandle */,
-                       InterfaceType /* interface */,
-                       CommunicationDirection /* direction */ ) const
+    void communicate ( CommDataHandleIF< DataHandle, Data >& dataHandle,
+                       InterfaceType interface,
+                       CommunicationDirection direction ) const
     {
-      //leafGridView().communicate( dataHandle, interface, direction );
+#if HAVE_MPI
+      if( !dataHandle.contains( dim, 0 ) )
+        return;
+
+      const InterfaceMap* interfaceMap = nullptr;
+      switch( interface )
+      {
+        case InteriorBorder_All_Interface:
+          interfaceMap = ownerOverlapInterface_.get();
+          break;
+        case Overlap_OverlapFront_Interface:
+        case Overlap_All_Interface:
+        case All_All_Interface:
+          interfaceMap = allAllInterface_.get();
+          break;
+        default:
+          break;
+      }
+      if( !interfaceMap || interfaceMap->empty() )
+        return;
+
+      CellDataHandle< CommDataHandleIF< DataHandle, Data >, Data > cellHandle( *this, dataHandle );
+      VariableSizeCommunicator<> communicator( comm_, *interfaceMap );
+      if( direction == ForwardCommunication )
+        communicator.forward( cellHandle );
+      else
+        communicator.backward( cellHandle );
+#else
+      static_cast<void>(dataHandle);
+      static_cast<void>(interface);
+      static_cast<void>(direction);
+#endif
     }
 
     /** \brief obtain CollectiveCommunication object
@@ -641,18 +711,31 @@ namespace Dune
 
     // data handle interface different between geo and interface
 
-    /** \brief rebalance the load each process has to handle
-     *
-     *  A parallel grid is redistributed such that each process has about
-     *  the same load (e.g., the same number of leaf entites).
+    /** \brief distribute the grid among all processes
      *
-     *  \note DUNE does not specify, how the load is measured.
+     *  Every process has to hold the same global grid. The cells are
+     *  partitioned by recursive coordinate bisection of their centroids,
+     *  which every process computes by itself, so the only communication
+     *  is that of later data exchanges. Each process then keeps its own
+     *  cells followed by one layer of overlap cells as a new
+     *  UnstructuredGrid, and an owned global grid is released.
+     *  globalCell() still identifies the cells across processes.
      *
-     *  \returns \b true, if the grid has changed.
+     *  \returns \b true, if the grid has changed, i.e. if there is more
+     *           than one process and the grid was not distributed before.
      */
     bool loadBalance ()
     {
-      return false ;
+#if HAVE_MPI
+      Opm::UnstructuredGridDistribution distribution;
+      UnstructuredGridPtr localGrid = distributeGrid( distribution );
+      if( !localGrid )
+        return false;
+      switchToLocalGrid( std::move( localGrid ), distribution );
+      return true;
+#else
+      return false;
+#endif
     }
 
     /** \brief rebalance the load each process has to handle
@@ -671,9 +754,43 @@ namespace Dune
      */
 
     template< class DataHandle, class Data >
-    bool loadBalance ( CommDataHandleIF< DataHandle, Data >& /* datahandle */ )
-    {
+    bool loadBalance ( CommDataHandleIF< DataHandle, Data >& dataHandle )
+    {
+#if HAVE_MPI
+      Opm::UnstructuredGridDistribution distribution;
+      UnstructuredGridPtr localGrid = distributeGrid( distribution );
+      if( !localGrid )
+        return false;
+
+      // Every process holds the global grid, so the data of the local cells
+      // is copied from it without communication.
+      const bool hasCellData = dataHandle.contains( dim, 0 );
+      CopyBuffer< Data > buffer;
+      std::vector< std::size_t > sizes;
+      if( hasCellData )
+      {
+        for( const int cell : distribution.global_cell_index )
+        {
+          const auto entity = this->entity( typename Codim< 0 >::EntitySeed( cell ) );
+          sizes.push_back( dataHandle.size( entity ) );
+          dataHandle.gather( buffer, entity );
+        }
+      }
+
+      switchToLocalGrid( std::move( localGrid ), distribution );
+
+      if( hasCellData )
+      {
+        for( std::size_t cell = 0; cell < sizes.size(); ++cell )
+        {
+          dataHandle.scatter( buffer, this->entity( typename Codim< 0 >::EntitySeed( cell ) ), sizes[ cell ] );
+        }
+      }
+      return true;
+#else
+      static_cast<void>(dataHandle);
       return false;
+#endif
     }
 
     /** \brief rebalance the load each process has to handle
@@ -774,8 +891,8 @@ namespace Dune
 
     const int* globalCell() const
     {
-      assert( grid_.global_cell != 0 );
-      return grid_.global_cell;
+      assert( grid_->global_cell != 0 );
+      return grid_->global_cell;
     }
 
     void getIJK(const int c, std::array<int,3>& ijk) const
@@ -850,11 +967,11 @@ namespace Dune
       {
         case 0:
           {
-            return cellVertices_[ index ].size();
+            return cellVertexPos_[ index+1 ] - cellVertexPos_[ index ];
           }
         case 1:
           {
-            return 0;//grid_.cell_facepos[ index+1 ] - grid_.cell_facepos[ index ];
+            return 0;//grid_->cell_facepos[ index+1 ] - grid_->cell_facepos[ index ];
           }
         case dim:
           {
@@ -865,7 +982,7 @@ namespace Dune
     }
 
     template <class EntitySeed>
-    GlobalCoordinate
+    const GlobalCoordinate&
     corner( const EntitySeed& seed, const int i ) const
     {
       const int codim = EntitySeed :: codimension;
@@ -873,21 +990,19 @@ namespace Dune
       {
         case 0:
           {
-            const int coordIndex = GlobalCoordinate :: dimension * cellVertices_[ seed.index() ][ i ];
-            return copyToGlobalCoordinate( grid_.node_coordinates + coordIndex );
+            return cellCorners_[ cellVertexPos_[ seed.index() ] + i ];
           }
         case 1:
           {
-            const int faceVertex = grid_.face_nodes[grid_.face_nodepos[seed.index()] + i];
-            return copyToGlobalCoordinate( grid_.node_coordinates + GlobalCoordinate :: dimension * faceVertex );
+            return nodeCoordinates_[ grid_->face_nodes[ grid_->face_nodepos[ seed.index() ] + i ] ];
           }
         case dim:
           {
-            const int coordIndex = GlobalCoordinate :: dimension * seed.index();
-            return copyToGlobalCoordinate( grid_.node_coordinates + coordIndex );
+            return nodeCoordinates_[ seed.index() ];
           }
       }
-      return GlobalCoordinate( 0 );
+      DUNE_THROW(InvalidStateException,"codimension not implemented");
+      return nodeCoordinates_[ 0 ];
     }
 
     template <class EntitySeed>
@@ -899,9 +1014,9 @@ namespace Dune
         case 0:
           return 1;
         case 1:
-          return grid_.cell_facepos[ index+1 ] - grid_.cell_facepos[ index ];
+          return grid_->cell_facepos[ index+1 ] - grid_->cell_facepos[ index ];
         case dim:
-          return cellVertices_[ index ].size();
+          return cellVertexPos_[ index+1 ] - cellVertexPos_[ index ];
       }
       return 0;
     }
@@ -924,16 +1039,16 @@ namespace Dune
       {
         if ( codim == 1 )
         {
-          return EntitySeed( grid_.cell_faces[ grid_.cell_facepos[ baseSeed.index() ] + i ] );
+          return EntitySeed( grid_->cell_faces[ grid_->cell_facepos[ baseSeed.index() ] + i ] );
         }
         else if ( codim == dim )
         {
-          return EntitySeed( cellVertices_[ baseSeed.index() ][ i ] );
+          return EntitySeed( cellVertices_[ cellVertexPos_[ baseSeed.index() ] + i ] );
         }
       }
       else if ( EntitySeedArg::codimension == 1 && codim == dim )
       {
-        return EntitySeed( grid_.face_nodes[ grid_.face_nodepos[ baseSeed.index() + i ] ]);
+        return EntitySeed( grid_->face_nodes[ grid_->face_nodepos[ baseSeed.index() + i ] ]);
       }
 
       DUNE_THROW(NotImplemented,"codimension not available");
@@ -951,25 +1066,51 @@ namespace Dune
       return emptyDummy;
     }
 
+    template <class EntitySeed>
+    PartitionType partitionType( const EntitySeed& seed ) const
+    {
+      // The owned cells precede the overlap cells.
+      if( EntitySeed::codimension == 0 && seed.index() >= numOwnedCells_ )
+      {
+        return OverlapEntity;
+      }
+      return InteriorEntity;
+    }
+
+    //! number of entities of a codimension an iterator of a partition visits
+    template< PartitionIteratorType pitype >
+    int partitionSize( const int codim ) const
+    {
+      if( pitype == Ghost_Partition )
+      {
+        return 0;
+      }
+      if( codim == 0 && ( pitype == Interior_Partition || pitype == InteriorBorder_Partition ) )
+      {
+        return numOwnedCells_;
+      }
+      return size( codim );
+    }
+
     int indexInInside( const typename Codim<0>::EntitySeed& seed, const int i ) const
     {
-      return ( grid_.cell_facetag ) ? cartesianIndexInInside( seed, i ) : i;
+      return ( grid_->cell_facetag ) ? cartesianIndexInInside( seed, i ) : i;
     }
 
     int cartesianIndexInInside( const typename Codim<0>::EntitySeed& seed, const int i ) const
     {
       assert( i>= 0 && i<subEntities( seed, 1 ) );
-      return grid_.cell_facetag[ grid_.cell_facepos[ seed.index() ] + i ] ;
+      return grid_->cell_facetag[ grid_->cell_facepos[ seed.index() ] + i ] ;
     }
 
     typename Codim<0>::EntitySeed
     neighbor( const typename Codim<0>::EntitySeed& seed, const int i ) const
     {
       const int face = this->template subEntitySeed<1>( seed, i ).index();
-      int nb = grid_.face_cells[ 2 * face ];
+      int nb = grid_->face_cells[ 2 * face ];
       if( nb == seed.index() )
       {
-        nb = grid_.face_cells[ 2 * face + 1 ];
+        nb = grid_->face_cells[ 2 * face + 1 ];
       }
 
       typedef typename Codim<0>::EntitySeed EntitySeed;
@@ -979,7 +1120,7 @@ namespace Dune
     int
     indexInOutside( const typename Codim<0>::EntitySeed& seed, const int i ) const
     {
-      if( grid_.cell_facetag )
+      if( grid_->cell_facetag )
       {
         // if cell_facetag is present we assume pseudo Cartesian corner point case
         const int in_inside = cartesianIndexInInside( seed, i );
@@ -987,18 +1128,8 @@ namespace Dune
       }
       else
       {
-        typedef typename Codim<0>::EntitySeed EntitySeed;
-        EntitySeed nb = neighbor( seed, i );
-        const int faces = subEntities( seed, 1 );
-        for( int face = 0; face<faces; ++ face )
-        {
-          if( neighbor( nb, face ).equals(seed) )
-          {
-            return indexInInside( nb, face );
-          }
-        }
-        DUNE_THROW(InvalidStateException,"inverse intersection not found");
-        return -1;
+        assert( indexInOutside_[ grid_->cell_facepos[ seed.index() ] + i ] >= 0 );
+        return indexInOutside_[ grid_->cell_facepos[ seed.index() ] + i ];
       }
     }
 
@@ -1008,8 +1139,8 @@ namespace Dune
     {
       const int face  = this->template subEntitySeed<1>( seed, i ).index();
       const int normalIdx = face * GlobalCoordinate :: dimension ;
-      GlobalCoordinate normal = copyToGlobalCoordinate( grid_.face_normals + normalIdx );
-      const int nb = grid_.face_cells[ 2*face ];
+      GlobalCoordinate normal = copyToGlobalCoordinate( grid_->face_normals + normalIdx );
+      const int nb = grid_->face_cells[ 2*face ];
       if( nb != seed.index() )
       {
         normal *= -1.0;
@@ -1022,7 +1153,7 @@ namespace Dune
     unitOuterNormal( const EntitySeed& seed, const int i ) const
     {
       const int face  = this->template subEntitySeed<1>( seed, i ).index();
-      if( seed.index() == grid_.face_cells[ 2*face ] )
+      if( seed.index() == grid_->face_cells[ 2*face ] )
       {
         return unitOuterNormals_[ face ];
       }
@@ -1035,28 +1166,28 @@ namespace Dune
     }
 
     template <class EntitySeed>
-    GlobalCoordinate centroids( const EntitySeed& seed ) const
+    const GlobalCoordinate& centroids( const EntitySeed& seed ) const
     {
-      const int index = GlobalCoordinate :: dimension * seed.index();
+      const int index = seed.index();
       const int codim = EntitySeed::codimension;
-      assert( index >= 0 && index < size( codim ) * GlobalCoordinate :: dimension );
+      assert( index >= 0 && index < size( codim ) );
 
       if( codim == 0 )
       {
-        return copyToGlobalCoordinate( grid_.cell_centroids + index );
+        return cellCentroids_[ index ];
       }
       else if ( codim == 1 )
       {
-        return copyToGlobalCoordinate( grid_.face_centroids + index );
+        return faceCentroids_[ index ];
       }
       else if( codim == dim )
       {
-        return copyToGlobalCoordinate( grid_.node_coordinates + index );
+        return nodeCoordinates_[ index ];
       }
       else
       {
         DUNE_THROW(InvalidStateException,"codimension not implemented");
-        return GlobalCoordinate( 0 );
+        return nodeCoordinates_[ 0 ];
       }
     }
 
@@ -1077,11 +1208,11 @@ namespace Dune
       const int codim = EntitySeed::codimension;
       if( codim == 0 )
       {
-        return grid_.cell_volumes[ index ];
+        return grid_->cell_volumes[ index ];
       }
       else if ( codim == 1 )
       {
-        return grid_.face_areas[ index ];
+        return grid_->face_areas[ index ];
       }
       else if ( codim == dim )
       {
@@ -1099,15 +1230,18 @@ namespace Dune
       // copy Cartesian dimensions
       for( int i=0; i<3; ++i )
       {
-        cartDims_[ i ] = grid_.cartdims[ i ];
+        cartDims_[ i ] = grid_->cartdims[ i ];
       }
 
       // setup list of cell vertices
       const int numCells = size( 0 );
-      cellVertices_.resize( numCells );
+      cellVertexPos_.assign( 1, 0 );
+      cellVertexPos_.reserve( numCells+1 );
+      cellVertices_.clear();
+      std::vector< int > vertices;
 
       // sort vertices such that they comply with the dune cube reference element
-      if( grid_.cell_facetag )
+      if( grid_->cell_facetag )
       {
         typedef std::array<int, 3> KeyType;
         std::map< const KeyType, const int > vertexFaceTags;
@@ -1140,14 +1274,14 @@ namespace Dune
 
           std::vector< vertexmap_t > cell_pts( dim*2 );
 
-          for (int hf=grid_.cell_facepos[ c ]; hf < grid_.cell_facepos[c+1]; ++hf)
+          for (int hf=grid_->cell_facepos[ c ]; hf < grid_->cell_facepos[c+1]; ++hf)
           {
-            const int f = grid_.cell_faces[ hf ];
-            const int faceTag = grid_.cell_facetag[ hf ];
+            const int f = grid_->cell_faces[ hf ];
+            const int faceTag = grid_->cell_facetag[ hf ];
 
-            for( int nodepos=grid_.face_nodepos[f]; nodepos<grid_.face_nodepos[f+1]; ++nodepos )
+            for( int nodepos=grid_->face_nodepos[f]; nodepos<grid_->face_nodepos[f+1]; ++nodepos )
             {
-              const int node = grid_.face_nodes[ nodepos ];
+              const int node = grid_->face_nodes[ nodepos ];
               iterator it = cell_pts[ faceTag ].find( node );
               if( it == cell_pts[ faceTag ].end() )
               {
@@ -1179,7 +1313,7 @@ namespace Dune
 
           assert( int(vertexList.size()) == ( dim == 2 ) ? 4 : 8 );
 
-          cellVertices_[ c ].resize( vertexList.size() );
+          vertices.assign( vertexList.size(), -1 );
           for( auto it = vertexList.begin(), end = vertexList.end(); it != end; ++it )
           {
             assert( (*it).second.size() == dim );
@@ -1190,12 +1324,14 @@ namespace Dune
             assert( vx != vertexFaceTags.end() );
             if( vx != vertexFaceTags.end() )
             {
-              if( (*vx).second >= int(cellVertices_[ c ].size()) )
-                cellVertices_[ c ].resize( (*vx).second+1 );
+              if( (*vx).second >= int(vertices.size()) )
+                vertices.resize( (*vx).second+1 );
               // store node number on correct local position
-              cellVertices_[ c ][ (*vx).second ] = (*it).first ;
+              vertices[ (*vx).second ] = (*it).first ;
             }
           }
+          cellVertices_.insert( cellVertices_.end(), vertices.begin(), vertices.end() );
+          cellVertexPos_.push_back( cellVertices_.size() );
         }
         // if face_tag is available we assume that the elements follow a cube-like structure
         geomTypes_.resize(dim + 1);
@@ -1206,21 +1342,21 @@ namespace Dune
           geomTypes_[codim].push_back(tmp);
         }
       }
-      else // if ( grid_.cell_facetag )
+      else // if ( grid_->cell_facetag )
       {
         for (int c = 0; c < numCells; ++c)
         {
           std::set<int> cell_pts;
-          for (int hf=grid_.cell_facepos[ c ]; hf < grid_.cell_facepos[c+1]; ++hf)
+          for (int hf=grid_->cell_facepos[ c ]; hf < grid_->cell_facepos[c+1]; ++hf)
           {
-             int f = grid_.cell_faces[ hf ];
-             const int* fnbeg = grid_.face_nodes + grid_.face_nodepos[f];
-             const int* fnend = grid_.face_nodes + grid_.face_nodepos[f+1];
+             int f = grid_->cell_faces[ hf ];
+             const int* fnbeg = grid_->face_nodes + grid_->face_nodepos[f];
+             const int* fnend = grid_->face_nodes + grid_->face_nodepos[f+1];
              cell_pts.insert(fnbeg, fnend);
           }
 
-          cellVertices_[ c ].resize( cell_pts.size() );
-          std::copy(cell_pts.begin(), cell_pts.end(), cellVertices_[ c ].begin() );
+          cellVertices_.insert( cellVertices_.end(), cell_pts.begin(), cell_pts.end() );
+          cellVertexPos_.push_back( cellVertices_.size() );
         }
         // if no face_tag is available we assume that no reference element can be
         // assigned to the elements
@@ -1238,27 +1374,215 @@ namespace Dune
           }
           geomTypes_[codim].push_back(tmp);
         }
-      } // end else of ( grid_.cell_facetag )
+      } // end else of ( grid_->cell_facetag )
 
-      unitOuterNormals_.resize( grid_.number_of_faces );
-      for( int face = 0; face < grid_.number_of_faces; ++face )
+      unitOuterNormals_.resize( grid_->number_of_faces );
+      for( int face = 0; face < grid_->number_of_faces; ++face )
       {
          const int normalIdx = face * GlobalCoordinate :: dimension ;
-         GlobalCoordinate normal = copyToGlobalCoordinate( grid_.face_normals + normalIdx );
+         GlobalCoordinate normal = copyToGlobalCoordinate( grid_->face_normals + normalIdx );
          normal /= normal.two_norm();
 
          unitOuterNormals_[ face ] = normal;
       }
+
+      initGeometryCache();
+    }
+
+    //! copy the coordinates into the caches returned by corner() and centroids()
+    void initGeometryCache()
+    {
+      nodeCoordinates_.resize( grid_->number_of_nodes );
+      for( int node = 0; node < grid_->number_of_nodes; ++node )
+      {
+        nodeCoordinates_[ node ] = copyToGlobalCoordinate( grid_->node_coordinates + GlobalCoordinate :: dimension * node );
+      }
+      faceCentroids_.resize( grid_->number_of_faces );
+      for( int face = 0; face < grid_->number_of_faces; ++face )
+      {
+        faceCentroids_[ face ] = copyToGlobalCoordinate( grid_->face_centroids + GlobalCoordinate :: dimension * face );
+      }
+      const int numCells = size( 0 );
+      cellCentroids_.resize( numCells );
+      for( int c = 0; c < numCells; ++c )
+      {
+        cellCentroids_[ c ] = copyToGlobalCoordinate( grid_->cell_centroids + GlobalCoordinate :: dimension * c );
+      }
+
+      // the corners of a cell are stored next to each other
+      cellCorners_.resize( cellVertices_.size() );
+      for( std::size_t i = 0; i < cellVertices_.size(); ++i )
+      {
+        cellCorners_[ i ] = nodeCoordinates_[ cellVertices_[ i ] ];
+      }
+
+      // the cell-face facetag determines the face in the neighbor otherwise
+      indexInOutside_.clear();
+      if( !grid_->cell_facetag )
+      {
+        // local index of each face in the cell on either side
+        std::vector< int > faceInCell( 2 * grid_->number_of_faces, -1 );
+        for( int c = 0; c < numCells; ++c )
+        {
+          for( int hf = grid_->cell_facepos[ c ]; hf < grid_->cell_facepos[ c+1 ]; ++hf )
+          {
+            const int face = grid_->cell_faces[ hf ];
+            const int side = ( grid_->face_cells[ 2*face ] == c ) ? 0 : 1;
+            faceInCell[ 2*face + side ] = hf - grid_->cell_facepos[ c ];
+          }
+        }
+        indexInOutside_.resize( grid_->cell_facepos[ numCells ] );
+        for( int c = 0; c < numCells; ++c )
+        {
+          for( int hf = grid_->cell_facepos[ c ]; hf < grid_->cell_facepos[ c+1 ]; ++hf )
+          {
+            const int face = grid_->cell_faces[ hf ];
+            const int side = ( grid_->face_cells[ 2*face ] == c ) ? 0 : 1;
+            indexInOutside_[ hf ] = faceInCell[ 2*face + 1 - side ];
+          }
+        }
+      }
     }
 
   protected:
-    std::unique_ptr< UnstructuredGridType, UnstructuredGridDeleter > gridPtr_;
-    const UnstructuredGridType& grid_;
+#if HAVE_MPI
+    typedef VariableSizeCommunicator<>::InterfaceMap InterfaceMap;
+
+    //! buffer for the data of the cells kept by loadBalance()
+    template< class Data >
+    class CopyBuffer
+    {
+    public:
+      void write( const Data& value ) { data_.push_back( value ); }
+      void read( Data& value ) { value = data_[ pos_++ ]; }
+
+    private:
+      std::vector< Data > data_;
+      std::size_t pos_ = 0;
+    };
+
+    //! adapter of a data handle for entities to the cell indices of VariableSizeCommunicator
+    template< class DataHandle, class Data >
+    class CellDataHandle
+    {
+    public:
+      typedef Data DataType;
+
+      CellDataHandle( const PolyhedralGrid& grid, DataHandle& handle )
+        : grid_( grid ), handle_( handle )
+      {}
+
+      bool fixedsize()
+      {
+        return handle_.fixedsize( dim, 0 );
+      }
+
+      std::size_t size( std::size_t i )
+      {
+        return handle_.size( entity( i ) );
+      }
+
+      template< class Buffer >
+      void gather( Buffer& buffer, std::size_t i )
+      {
+        handle_.gather( buffer, entity( i ) );
+      }
+
+      template< class Buffer >
+      void scatter( Buffer& buffer, std::size_t i, std::size_t n )
+      {
+        handle_.scatter( buffer, entity( i ), n );
+      }
+
+    private:
+      typename Codim< 0 >::Entity entity( std::size_t i ) const
+      {
+        return grid_.entity( typename Codim< 0 >::EntitySeed( i ) );
+      }
+
+      const PolyhedralGrid& grid_;
+      DataHandle& handle_;
+    };
+
+    //! compute the distribution of the grid, null if there is nothing to distribute
+    UnstructuredGridPtr distributeGrid( Opm::UnstructuredGridDistribution& distribution ) const
+    {
+      const CollectiveCommunication comm( MPIHelper::getCommunicator() );
+      if( comm.size() == 1 || comm_.size() > 1 )
+      {
+        return UnstructuredGridPtr();
+      }
+
+      const std::vector< int > part = Opm::partitionCellsByCoordinates( *grid_, comm.size() );
+      distribution = Opm::distributeUnstructuredGrid( *grid_, part, comm.rank() );
+      UnstructuredGridPtr localGrid( Opm::extractSubGrid( *grid_, distribution.global_cell_index ) );
+      if( !localGrid )
+      {
+        OPM_THROW(std::runtime_error, "Failed to construct the local grid.");
+      }
+      return localGrid;
+    }
+
+    //! replace the global grid by the local one
+    void switchToLocalGrid( UnstructuredGridPtr localGrid,
+                            const Opm::UnstructuredGridDistribution& distribution )
+    {
+      gridPtr_ = std::move( localGrid );
+      grid_ = gridPtr_.get();
+      cpgridView_.reset();
+      numOwnedCells_ = distribution.num_owned;
+      comm_ = CollectiveCommunication( MPIHelper::getCommunicator() );
+
+      ownerOverlapInterface_ = std::make_shared< InterfaceMap >();
+      for( const auto& procCells : distribution.owner_overlap )
+      {
+        auto& lists = (*ownerOverlapInterface_)[ procCells.first ];
+        lists.first.reserve( procCells.second.first.size() );
+        for( const int cell : procCells.second.first )
+          lists.first.add( cell );
+        lists.second.reserve( procCells.second.second.size() );
+        for( const int cell : procCells.second.second )
+          lists.second.add( cell );
+      }
+      allAllInterface_ = std::make_shared< InterfaceMap >();
+      for( const auto& procCells : distribution.all_all )
+      {
+        auto& lists = (*allAllInterface_)[ procCells.first ];
+        lists.first.reserve( procCells.second.size() );
+        lists.second.reserve( procCells.second.size() );
+        for( const int cell : procCells.second )
+        {
+          lists.first.add( cell );
+          lists.second.add( cell );
+        }
+      }
+
+      geomTypes_.clear();
+      init();
+    }
+#endif
+
+    UnstructuredGridPtr gridPtr_;
+    //! view of the CpGrid this grid was constructed from, if any
+    std::shared_ptr< const cpgrid::UnstructuredGridView > cpgridView_;
+    const UnstructuredGridType* grid_;
+    //! number of owned cells, which precede the overlap cells
+    int numOwnedCells_;
 
     CollectiveCommunication comm_;
     std::array< int, 3 > cartDims_;
     std::vector< std::vector< GeometryType > > geomTypes_;
-    std::vector< std::vector< int > > cellVertices_;
+    //! vertices of cell c are cellVertices_[ cellVertexPos_[ c ] ... cellVertexPos_[ c+1 ]-1 ]
+    std::vector< int > cellVertexPos_;
+    std::vector< int > cellVertices_;
+    //! coordinates of the vertices in cellVertices_
+    std::vector< GlobalCoordinate > cellCorners_;
+
+    std::vector< GlobalCoordinate > nodeCoordinates_;
+    std::vector< GlobalCoordinate > faceCentroids_;
+    std::vector< GlobalCoordinate > cellCentroids_;
+    //! index of each cell face in the neighbor, empty if there is a cell_facetag
+    std::vector< int > indexInOutside_;
 
     std::vector< GlobalCoordinate > unitOuterNormals_;
 
@@ -1266,6 +1590,13 @@ namespace Dune
     mutable GlobalIdSet globalIdSet_;
     mutable LocalIdSet localIdSet_;
 
+#if HAVE_MPI
+    //! cells to copy from owner to overlap cells, for each other process
+    std::shared_ptr< InterfaceMap > ownerOverlapInterface_;
+    //! cells held by this and each other process
+    std::shared_ptr< InterfaceMap > allAllInterface_;
+#endif
+
   private:
     // no copying
     PolyhedralGrid ( const PolyhedralGrid& );
@@ -139,6 +139,7 @@ namespace Dune
                        InterfaceType interface,
                        CommunicationDirection direction ) const
     {
+      grid().communicate( dataHandle, interface, direction );
     }
 
   protected:
@@ -33,7 +33,7 @@ namespace Dune
     PolyhedralGridIterator ( ExtraData data, const bool beginIterator )
     : Base( data )
     {
-      if( beginIterator )
+      if( beginIterator && data->template partitionSize< pitype >( codim ) > 0 )
         entityImpl() = EntityImpl( data, EntitySeed( 0 ) );
     }
 
@@ -47,7 +47,7 @@ namespace Dune
       int index = entityImpl().seed().index();
       ++index;
 
-      if( index >= entityImpl().data()->size( codim ) )
+      if( index >= entityImpl().data()->template partitionSize< pitype >( codim ) )
         entityImpl() = EntityImpl( entityImpl().data() );
       else
         entityImpl() = EntityImpl( entityImpl().data(), EntitySeed( index ) );
@@ -0,0 +1,63 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_BENCHMARKUTILITIES_HEADER_INCLUDED
+#define OPM_BENCHMARKUTILITIES_HEADER_INCLUDED
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace Opm
+{
+
+    /// Helpers shared by the benchmark programs, not installed.
+    namespace Benchmark
+    {
+
+        /// The clock the benchmarks are timed with.
+        typedef std::chrono::steady_clock Clock;
+
+        /// Wall-clock seconds elapsed since start.
+        inline double secondsSince(Clock::time_point start)
+        {
+            return std::chrono::duration<double>(Clock::now() - start).count();
+        }
+
+        /// Parse command line arguments of the form key=value.
+        /// Other arguments are reported on std::cerr and ignored.
+        inline std::map<std::string, std::string> parseArguments(int argc, char** argv)
+        {
+            std::map<std::string, std::string> args;
+            for (int i = 1; i < argc; ++i) {
+                const std::string arg(argv[i]);
+                const auto eq = arg.find('=');
+                if (eq == std::string::npos) {
+                    std::cerr << "Ignoring argument '" << arg << "', expected key=value.\n";
+                    continue;
+                }
+                args[arg.substr(0, eq)] = arg.substr(eq + 1);
+            }
+            return args;
+        }
+
+    } // namespace Benchmark
+
+} // namespace Opm
+
+#endif // OPM_BENCHMARKUTILITIES_HEADER_INCLUDED
@@ -146,6 +146,13 @@ namespace Opm
             return data_.size();
         }
 
+        /// Returns the row offsets. Row i is stored at positions
+        /// [rowStarts()[i], rowStarts()[i + 1]) of the contiguous data.
+        const std::vector<int>& rowStarts() const
+        {
+            return row_start_;
+        }
+
         /// Returns the size of a table row.
         int rowSize(int row) const
         {
@@ -0,0 +1,124 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/utility/SyntheticCornerPointModel.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+
+namespace Opm
+{
+
+    namespace
+    {
+        // Vertical shift of the cells behind each line of pillars. Entry i
+        // holds the shift of the cells with index i in this direction.
+        std::vector<double> faultShifts(int n, double density, double fault_throw,
+                                        std::mt19937& gen)
+        {
+            std::bernoulli_distribution is_fault(density);
+            std::vector<double> shift(n, 0.0);
+            for (int i = 1; i < n; ++i) {
+                shift[i] = shift[i - 1] + (is_fault(gen) ? fault_throw : 0.0);
+            }
+            return shift;
+        }
+    } // anonymous namespace
+
+    SyntheticCornerPointModel::SyntheticCornerPointModel(const SyntheticCornerPointParameters& params)
+        : dims_(params.dims)
+    {
+        const int nx = dims_[0];
+        const int ny = dims_[1];
+        const int nz = dims_[2];
+        const double dz = params.cellsize[2];
+        std::mt19937 gen(params.seed);
+
+        const double fault_throw = params.fault_throw * dz;
+        const std::vector<double> shift_i = faultShifts(nx, params.fault_density, fault_throw, gen);
+        const std::vector<double> shift_j = faultShifts(ny, params.fault_density, fault_throw, gen);
+
+        // The depth of each layer boundary is tracked per pillar. A layer is
+        // pinched at a pillar by giving it zero thickness there.
+        const int num_pillars = (nx + 1)*(ny + 1);
+        std::vector<double> bottom(num_pillars, 0.0);
+        std::vector<double> top(num_pillars);
+        std::bernoulli_distribution is_pinched(params.pinchout_fraction);
+
+        const std::size_t num_per_layer = 4*std::size_t(nx)*ny;
+        zcorn_.resize(2*num_per_layer*nz);
+        double max_depth = 0.0;
+        for (int k = 0; k < nz; ++k) {
+            for (int p = 0; p < num_pillars; ++p) {
+                top[p] = bottom[p] + (is_pinched(gen) ? 0.0 : dz);
+            }
+            for (int face = 0; face < 2; ++face) {
+                const std::vector<double>& depth = face == 0 ? bottom : top;
+                double* z = &zcorn_[(2*k + face)*num_per_layer];
+                for (int j = 0; j < ny; ++j) {
+                    for (int dj = 0; dj < 2; ++dj) {
+                        for (int i = 0; i < nx; ++i) {
+                            const double shift = shift_i[i] + shift_j[j];
+                            for (int di = 0; di < 2; ++di) {
+                                *z = depth[(j + dj)*(nx + 1) + i + di] + shift;
+                                max_depth = std::max(max_depth, *z);
+                                ++z;
+                            }
+                        }
+                    }
+                }
+            }
+            bottom.swap(top);
+        }
+
+        // Straight pillars spanning all corners, possibly sloping.
+        const double zmax = std::max(max_depth, dz);
+        const double offset = params.pillar_slope * zmax;
+        coord_.reserve(6*num_pillars);
+        for (int j = 0; j < ny + 1; ++j) {
+            const double y = j*params.cellsize[1];
+            for (int i = 0; i < nx + 1; ++i) {
+                const double x = i*params.cellsize[0];
+                const double pillar[6] = { x, y, 0.0, x + offset, y + offset, zmax };
+                coord_.insert(coord_.end(), pillar, pillar + 6);
+            }
+        }
+
+        std::bernoulli_distribution is_inactive(params.inactive_fraction);
+        actnum_.resize(std::size_t(nx)*ny*nz);
+        for (auto& active : actnum_) {
+            active = is_inactive(gen) ? 0 : 1;
+        }
+    }
+
+    grdecl SyntheticCornerPointModel::input() const
+    {
+        grdecl g;
+        g.dims[0] = dims_[0];
+        g.dims[1] = dims_[1];
+        g.dims[2] = dims_[2];
+        g.coord = coord_.data();
+        g.zcorn = zcorn_.data();
+        g.actnum = actnum_.data();
+        g.mapaxes = nullptr;
+        return g;
+    }
+
+} // namespace Opm
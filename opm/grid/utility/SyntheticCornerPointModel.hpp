@@ -0,0 +1,82 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_SYNTHETICCORNERPOINTMODEL_HEADER_INCLUDED
+#define OPM_SYNTHETICCORNERPOINTMODEL_HEADER_INCLUDED
+
+#include <opm/grid/cpgpreprocess/preprocess.h>
+
+#include <array>
+#include <vector>
+
+namespace Opm
+{
+
+    /// Parameters of a synthetic corner-point model.
+    ///
+    /// With the default values the model is the Cartesian box that
+    /// Dune::CpGrid::createCartesian() builds.
+    struct SyntheticCornerPointParameters
+    {
+        /// Number of cells in the i, j and k directions.
+        std::array<int, 3> dims = {{ 10, 10, 10 }};
+        /// Size of an undeformed cell in the x, y and z directions.
+        std::array<double, 3> cellsize = {{ 1.0, 1.0, 1.0 }};
+        /// Probability that a line of pillars (constant i or j) is a fault.
+        double fault_density = 0.0;
+        /// Vertical displacement of the cells on the far side of a fault,
+        /// in units of cellsize[2].
+        double fault_throw = 0.0;
+        /// Probability that a layer has zero thickness at a pillar.
+        /// Cells with zero thickness at all four pillars are pinched out.
+        double pinchout_fraction = 0.0;
+        /// Probability that a cell is inactive.
+        double inactive_fraction = 0.0;
+        /// Horizontal displacement of the pillar top relative to its
+        /// bottom, per unit height.
+        double pillar_slope = 0.0;
+        /// Seed of the random number generator.
+        unsigned int seed = 0;
+    };
+
+    /// A synthetic corner-point model in the arrays of the Eclipse grid
+    /// format, for testing and benchmarking grid processing.
+    class SyntheticCornerPointModel
+    {
+    public:
+        /// Generate the model.
+        /// \param[in] params  The parameters of the model.
+        explicit SyntheticCornerPointModel(const SyntheticCornerPointParameters& params);
+
+        /// The model as input for the grid processing. Refers to the
+        /// arrays of this object, which must outlive the result.
+        grdecl input() const;
+
+        const std::vector<double>& coord() const { return coord_; }
+        const std::vector<double>& zcorn() const { return zcorn_; }
+        const std::vector<int>& actnum() const { return actnum_; }
+
+    private:
+        std::array<int, 3> dims_;
+        std::vector<double> coord_;
+        std::vector<double> zcorn_;
+        std::vector<int> actnum_;
+    };
+
+} // namespace Opm
+
+#endif // OPM_SYNTHETICCORNERPOINTMODEL_HEADER_INCLUDED
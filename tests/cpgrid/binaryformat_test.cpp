@@ -0,0 +1,80 @@
+#include <config.h>
+
+#define NVERBOSE // to suppress our messages when throwing
+
+#define BOOST_TEST_MODULE BinaryGridFormatTests
+#define BOOST_TEST_NO_MAIN
+#include <boost/test/unit_test.hpp>
+#include <opm/grid/CpGrid.hpp>
+
+#include <array>
+#include <cstdio>
+#include <stdexcept>
+
+BOOST_AUTO_TEST_CASE(roundtrip)
+{
+    const std::string filename = "binaryformat_test.grid";
+    std::array<int, 3>    dims     = {{ 4, 3, 2 }};
+    std::array<double, 3> cellsize = {{ 1., 2., 3. }};
+    Dune::CpGrid original;
+    original.createCartesian(dims, cellsize);
+    original.writeBinaryFormat(filename);
+
+    Dune::CpGrid grid;
+    grid.readBinaryFormat(filename);
+    std::remove(filename.c_str());
+
+    BOOST_REQUIRE_EQUAL(grid.numCells(), original.numCells());
+    BOOST_REQUIRE_EQUAL(grid.numFaces(), original.numFaces());
+    BOOST_REQUIRE_EQUAL(grid.numVertices(), original.numVertices());
+    BOOST_CHECK(grid.logicalCartesianSize() == original.logicalCartesianSize());
+
+    for (int c = 0; c < grid.numCells(); ++c) {
+        BOOST_CHECK_EQUAL(grid.globalCell()[c], original.globalCell()[c]);
+        BOOST_CHECK_CLOSE(grid.cellVolume(c), original.cellVolume(c), 1e-10);
+        BOOST_REQUIRE_EQUAL(grid.numCellFaces(c), original.numCellFaces(c));
+        for (int f = 0; f < grid.numCellFaces(c); ++f) {
+            BOOST_CHECK_EQUAL(grid.cellFace(c, f), original.cellFace(c, f));
+        }
+    }
+
+    for (int f = 0; f < grid.numFaces(); ++f) {
+        for (int local = 0; local < 2; ++local) {
+            BOOST_CHECK_EQUAL(grid.faceCell(f, local), original.faceCell(f, local));
+        }
+        BOOST_CHECK_CLOSE(grid.faceArea(f), original.faceArea(f), 1e-10);
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(grid.faceNormal(f)[d] + 1.0, original.faceNormal(f)[d] + 1.0, 1e-10);
+        }
+    }
+
+    // The cell geometries have to refer to the read corners.
+    auto oit = original.leafbegin<0>();
+    for (auto it = grid.leafbegin<0>(); it != grid.leafend<0>(); ++it, ++oit) {
+        for (int corner = 0; corner < 8; ++corner) {
+            for (int d = 0; d < 3; ++d) {
+                BOOST_CHECK_CLOSE(it->geometry().corner(corner)[d] + 1.0,
+                                  oit->geometry().corner(corner)[d] + 1.0, 1e-10);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(missingFile)
+{
+    Dune::CpGrid grid;
+    BOOST_CHECK_THROW(grid.readBinaryFormat("binaryformat_test_missing.grid"), std::runtime_error);
+}
+
+bool
+init_unit_test_func()
+{
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    boost::unit_test::unit_test_main(&init_unit_test_func,
+                                     argc, argv);
+}
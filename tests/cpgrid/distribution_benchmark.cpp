@@ -0,0 +1,345 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/common/NodeSharedGrdecl.hpp>
+#include <opm/grid/utility/BenchmarkUtilities.hpp>
+#include <opm/grid/utility/SyntheticCornerPointModel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @file distribution_benchmark.cpp
+ * @brief Scaling benchmark of the distribution of CpGrid
+ *
+ * For each number of overlap layers a synthetic corner-point model is
+ * load balanced over all ranks of MPI_COMM_WORLD. Reported are the time of
+ * loadBalance() with its phases, of scatterData(), gatherData() and
+ * communicate(), the bytes and messages sent per rank, the owned and
+ * overlap cells per rank, the edge cut and the load imbalance.
+ *
+ * Run it for a range of rank counts with a local MPI installation, e.g.
+ *
+ *   for n in 1 2 4 8; do mpirun -np $n distribution_benchmark overlap=1,2,3 output=distribution.jsonl; done
+ *
+ * Strong scaling keeps cells fixed (default 1000000), weak scaling is
+ * selected by giving cells_per_rank instead. Further keys are nz (default
+ * 20), repeat (number of calls to communicate(), default 10), seed,
+ * node_aware (1 to partition among the nodes first, default 0),
+ * node_shared (1 to generate the model on rank 0 only, share it per
+ * node and build the global grid once per node, default 0) and output
+ * (file to append to, default: standard output). With node_shared only
+ * rank 0 keeps the global grid, hence scatterData() and gatherData() are
+ * not timed and reported as null.
+ *
+ * Each run writes one JSON object on a single line, so the output file of
+ * a series of runs is in the JSON Lines format, one run per line.
+ */
+
+#if HAVE_MPI
+
+namespace
+{
+
+    using Opm::Benchmark::Clock;
+    using Opm::Benchmark::parseArguments;
+    using Opm::Benchmark::secondsSince;
+    typedef Dune::cpgrid::CpGridData::AttributeSet Attribute;
+
+    long getLong(const std::map<std::string, std::string>& args,
+                 const std::string& key, long default_value)
+    {
+        auto it = args.find(key);
+        return it == args.end() ? default_value : std::atol(it->second.c_str());
+    }
+
+    std::vector<int> getList(const std::map<std::string, std::string>& args,
+                             const std::string& key, const std::string& default_value)
+    {
+        auto it = args.find(key);
+        std::istringstream list(it == args.end() ? default_value : it->second);
+        std::vector<int> values;
+        std::string value;
+        while (std::getline(list, value, ',')) {
+            values.push_back(std::atoi(value.c_str()));
+        }
+        return values;
+    }
+
+    /// A data handle for cells that sends one double per cell and counts
+    /// the values it packs.
+    class CountingDataHandle
+    {
+    public:
+        typedef double DataType;
+
+        bool fixedsize(int /*dim*/, int /*codim*/)
+        {
+            return true;
+        }
+        bool contains(int /*dim*/, int codim)
+        {
+            return codim == 0;
+        }
+        template<class T>
+        std::size_t size(const T&)
+        {
+            return 1;
+        }
+        template<class B, class T>
+        void gather(B& buffer, const T&)
+        {
+            buffer.write(1.0);
+            ++num_gathered_;
+        }
+        template<class B, class T>
+        void scatter(B& buffer, const T&, std::size_t n)
+        {
+            double value;
+            for (std::size_t i = 0; i < n; ++i) {
+                buffer.read(value);
+            }
+        }
+        std::size_t numGathered() const
+        {
+            return num_gathered_;
+        }
+    private:
+        std::size_t num_gathered_ = 0;
+    };
+
+    template<class T>
+    std::string jsonArray(const std::vector<T>& values)
+    {
+        std::ostringstream os;
+        os.precision(10);
+        os << '[';
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            os << (i == 0 ? "" : ", ") << values[i];
+        }
+        os << ']';
+        return os.str();
+    }
+
+    /// Collects the value of each rank on rank 0.
+    template<class T>
+    std::vector<T> perRank(const Dune::CpGrid& grid, T value)
+    {
+        std::vector<T> values(grid.comm().size());
+        grid.comm().gather(&value, values.data(), 1, 0);
+        return values;
+    }
+
+    double maxOverRanks(const Dune::CpGrid& grid, double value)
+    {
+        return grid.comm().max(value);
+    }
+
+    std::string benchmarkCase(const grdecl& input, const Dune::cpgrid::NodeSharedGrdecl* shared,
+                              int overlap_layers, int repeat, bool node_aware)
+    {
+        const auto& cc = Dune::MPIHelper::getCollectiveCommunication();
+        Dune::CpGrid grid;
+        if (shared) {
+            grid.processEclipseFormat(*shared, 0.0, false);
+        } else {
+            grid.processEclipseFormat(input, 0.0, false);
+        }
+        grid.setNodeAwarePartitioning(node_aware);
+
+        // Rank 0 has the global grid in either case.
+        const int num_global_cells = cc.max(grid.numCells());
+
+        cc.barrier();
+        auto start = Clock::now();
+        grid.loadBalance(overlap_layers);
+        const double load_balance_seconds = maxOverRanks(grid, secondsSince(start));
+
+        const auto& quality = grid.partitionQualityReport();
+
+        // Messages of communicate() with the InteriorBorder_All_Interface:
+        // we send to every rank that has a copy of one of our owned cells.
+        int num_messages = 0;
+        for (const auto& process : grid.getCellRemoteIndices()) {
+            for (const auto& remote : *process.second.first) {
+                if (remote.localIndexPair().local().attribute() == Attribute::owner) {
+                    ++num_messages;
+                    break;
+                }
+            }
+        }
+
+        CountingDataHandle communicate_handle;
+        cc.barrier();
+        start = Clock::now();
+        for (int i = 0; i < repeat; ++i) {
+            grid.communicate(communicate_handle, Dune::InteriorBorder_All_Interface,
+                             Dune::ForwardCommunication);
+        }
+        const double communicate_seconds = maxOverRanks(grid, secondsSince(start) / repeat);
+        const std::size_t communicate_bytes =
+            communicate_handle.numGathered() / repeat * sizeof(double);
+
+        // Unless shared per node, the global grid is present on all ranks,
+        // hence scatterData() copies locally. gatherData() exchanges the
+        // owned values with MPI_Allgatherv.
+        double scatter_seconds = 0.0;
+        double gather_seconds = 0.0;
+        std::size_t gather_bytes = 0;
+        if (!shared) {
+            CountingDataHandle scatter_handle;
+            cc.barrier();
+            start = Clock::now();
+            grid.scatterData(scatter_handle);
+            scatter_seconds = maxOverRanks(grid, secondsSince(start));
+
+            CountingDataHandle gather_handle;
+            cc.barrier();
+            start = Clock::now();
+            grid.gatherData(gather_handle);
+            gather_seconds = maxOverRanks(grid, secondsSince(start));
+            // Global index and size of each value are exchanged as well.
+            gather_bytes = gather_handle.numGathered() * (sizeof(double) + 2 * sizeof(int));
+        }
+
+        const auto report = grid.phaseTimingReport();
+        const auto messages_per_rank = perRank(grid, num_messages);
+        const auto communicate_bytes_per_rank = perRank(grid, communicate_bytes);
+        const auto gather_bytes_per_rank = perRank(grid, gather_bytes);
+
+        std::ostringstream json;
+        json.precision(10);
+        json << "{ \"ranks\": " << grid.comm().size()
+             << ", \"overlap_layers\": " << overlap_layers
+             << ", \"global_cells\": " << num_global_cells
+             << ", \"node_aware\": " << (node_aware ? "true" : "false")
+             << ", \"node_shared\": " << (shared ? "true" : "false")
+             << ", \"edge_cut\": " << quality.edge_cut
+             << ", \"inter_node_edge_cut\": " << quality.inter_node_edge_cut
+             << ", \"imbalance\": " << quality.imbalance()
+             << ", \"owned_cells\": " << jsonArray(quality.owned_cells)
+             << ", \"overlap_cells\": " << jsonArray(quality.overlap_cells)
+             << ", \"neighbour_ranks\": " << jsonArray(quality.neighbour_ranks)
+             << ", \"halo_cells_sent\": " << jsonArray(quality.halo_cells_sent)
+             << ", \"communicate_messages\": " << jsonArray(messages_per_rank)
+             << ", \"communicate_bytes\": " << jsonArray(communicate_bytes_per_rank)
+             << ", \"gather_bytes_contributed\": " << jsonArray(gather_bytes_per_rank)
+             << ", \"seconds\": { \"loadBalance\": " << load_balance_seconds
+             << ", \"communicate\": " << communicate_seconds;
+        if (shared) {
+            json << ", \"scatterData\": null, \"gatherData\": null }";
+        } else {
+            json << ", \"scatterData\": " << scatter_seconds
+                 << ", \"gatherData\": " << gather_seconds << " }";
+        }
+        json << ", \"phase_seconds_max\": {";
+        for (int i = 0; i < Dune::cpgrid::numGridPhases; ++i) {
+            json << (i == 0 ? " \"" : ", \"")
+                 << Dune::cpgrid::gridPhaseName(static_cast<Dune::cpgrid::GridPhase>(i))
+                 << "\": " << report.max[i];
+        }
+        json << " } }";
+        return json.str();
+    }
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+try
+{
+    Dune::MPIHelper::instance(argc, argv);
+    const auto& cc = Dune::MPIHelper::getCollectiveCommunication();
+    const auto args = parseArguments(argc, argv);
+
+    // Strong scaling unless the size per rank is given.
+    const long cells_per_rank = getLong(args, "cells_per_rank", 0);
+    const long cells = cells_per_rank > 0 ? cells_per_rank * cc.size()
+        : getLong(args, "cells", 1000000);
+    const int nz = getLong(args, "nz", 20);
+    const int repeat = std::max(1L, getLong(args, "repeat", 10));
+    const bool node_aware = getLong(args, "node_aware", 0) != 0;
+
+    Opm::SyntheticCornerPointParameters params;
+    const int nxy = std::max(1, static_cast<int>(std::sqrt(double(cells) / nz)));
+    params.dims = {{ nxy, nxy, nz }};
+    params.cellsize = {{ 100.0, 100.0, 2.0 }};
+    params.fault_density = 0.1;
+    params.fault_throw = 0.5;
+    params.pillar_slope = 0.1;
+    params.seed = getLong(args, "seed", 0);
+    const bool node_shared = getLong(args, "node_shared", 0) != 0;
+    std::unique_ptr<Opm::SyntheticCornerPointModel> model;
+    grdecl input{};
+    if (!node_shared || cc.rank() == 0) {
+        model.reset(new Opm::SyntheticCornerPointModel(params));
+        input = model->input();
+    }
+    std::unique_ptr<Dune::cpgrid::NodeSharedGrdecl> shared;
+    if (node_shared) {
+        shared.reset(new Dune::cpgrid::NodeSharedGrdecl(input, cc));
+    }
+
+    // A single line per run, so that runs for several rank counts can be
+    // appended to one JSON Lines file.
+    std::ostringstream json;
+    json << "{ \"benchmark\": \"distribution\""
+         << ", \"scaling\": \"" << (cells_per_rank > 0 ? "weak" : "strong") << "\""
+         << ", \"cases\": [";
+    bool first = true;
+    for (int overlap_layers : getList(args, "overlap", "1")) {
+        json << (first ? " " : ", ") << benchmarkCase(input, shared.get(), overlap_layers,
+                                                         repeat, node_aware);
+        first = false;
+    }
+    json << " ] }\n";
+
+    if (cc.rank() == 0) {
+        auto output = args.find("output");
+        if (output == args.end()) {
+            std::cout << json.str();
+        } else {
+            std::ofstream file(output->second, std::ios::app);
+            file << json.str();
+        }
+    }
+    return EXIT_SUCCESS;
+}
+catch (const std::exception& e) {
+    std::cerr << "Program threw an exception: " << e.what() << "\n";
+    throw;
+}
+
+#else // #if HAVE_MPI
+
+int main()
+{
+    std::cerr << "distribution_benchmark needs MPI.\n";
+    return EXIT_SUCCESS;
+}
+
+#endif
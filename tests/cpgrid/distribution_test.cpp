@@ -7,6 +7,20 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/grid/CpGrid.hpp>
+#include <opm/grid/common/AsyncCellGather.hpp>
+#include <opm/grid/common/NodeSharedGrdecl.hpp>
+#include <opm/grid/common/NodeTopology.hpp>
+#include <opm/grid/common/PartitionCache.hpp>
+#include <opm/grid/common/WellConnections.hpp>
+#include <opm/grid/common/ZoltanPartition.hpp>
+#include <opm/grid/utility/SyntheticCornerPointModel.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <numeric>
+#include <set>
 
 
 // Warning suppression for Dune includes.
@@ -492,6 +506,585 @@ BOOST_AUTO_TEST_CASE(intersectionOverlap)
     }
 }
 
+BOOST_AUTO_TEST_CASE(memoryUsage)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+
+    auto usage = grid.memoryUsage();
+    BOOST_CHECK(usage.global_view.topology > 0);
+    BOOST_CHECK(usage.global_view.geometry > 0);
+    BOOST_CHECK(usage.global_view.entity_data > 0);
+    BOOST_CHECK_EQUAL(usage.global_view.saved_vertex_copy,
+                      std::size_t(grid.numVertices()) * sizeof(Dune::FieldVector<double, 3>));
+    BOOST_CHECK_EQUAL(usage.distributed_view.total(), std::size_t(0));
+    BOOST_CHECK_EQUAL(usage.total(), usage.global_view.total());
+
+    grid.loadBalance();
+    auto balanced_usage = grid.memoryUsage();
+    BOOST_CHECK_EQUAL(balanced_usage.global_view.topology, usage.global_view.topology);
+#if HAVE_MPI
+    if (grid.comm().size() > 1) {
+        BOOST_CHECK(balanced_usage.distributed_view.topology > 0);
+        BOOST_CHECK(balanced_usage.distributed_view.interfaces > 0);
+    }
+#endif
+
+    // Aggregation over all processes.
+    auto sum = balanced_usage.sum(grid.comm());
+    auto max = balanced_usage.max(grid.comm());
+    BOOST_CHECK_EQUAL(sum.global_view.topology,
+                      grid.comm().size() * balanced_usage.global_view.topology);
+    BOOST_CHECK(max.total() <= sum.total());
+    BOOST_CHECK(max.distributed_view.total() >= balanced_usage.distributed_view.total());
+}
+
+BOOST_AUTO_TEST_CASE(phaseTimings)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    grid.loadBalance();
+
+    auto timings = grid.phaseTimings();
+    for (double seconds : timings.allSeconds()) {
+        BOOST_CHECK(seconds >= 0.0);
+    }
+    BOOST_CHECK_EQUAL(timings.seconds(Dune::cpgrid::GridPhase::Minpv), 0.0);
+
+    auto report = grid.phaseTimingReport();
+    for (int i = 0; i < Dune::cpgrid::numGridPhases; ++i) {
+        BOOST_CHECK(report.min[i] <= report.avg[i] * (1.0 + 1e-12));
+        BOOST_CHECK(report.avg[i] <= report.max[i] * (1.0 + 1e-12));
+        BOOST_CHECK(report.min[i] <= timings.allSeconds()[i]);
+        BOOST_CHECK(timings.allSeconds()[i] <= report.max[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(partitionQuality)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    BOOST_CHECK(grid.partitionQualityReport().owned_cells.empty());
+    grid.loadBalance();
+
+#if HAVE_MPI
+    const auto& report = grid.partitionQualityReport();
+    const std::size_t procs = grid.comm().size();
+    BOOST_REQUIRE_EQUAL(report.owned_cells.size(), procs);
+    BOOST_REQUIRE_EQUAL(report.overlap_cells.size(), procs);
+    BOOST_REQUIRE_EQUAL(report.neighbour_ranks.size(), procs);
+    BOOST_CHECK_EQUAL(std::accumulate(report.owned_cells.begin(),
+                                      report.owned_cells.end(), 0), 8*4*2);
+    BOOST_CHECK_EQUAL(report.owned_cells[grid.comm().rank()] +
+                      report.overlap_cells[grid.comm().rank()], grid.numCells());
+    BOOST_CHECK_EQUAL(std::accumulate(report.halo_cells_sent.begin(),
+                                      report.halo_cells_sent.end(), 0),
+                      std::accumulate(report.halo_cells_received.begin(),
+                                      report.halo_cells_received.end(), 0));
+    BOOST_CHECK_EQUAL(report.weighted_edge_cut, double(report.edge_cut));
+    BOOST_CHECK_EQUAL(report.cells_moved_for_wells, std::size_t(0));
+    BOOST_CHECK(report.imbalance() >= 1.0);
+    if (procs > 1) {
+        BOOST_CHECK(report.edge_cut > 0);
+        BOOST_CHECK(report.neighbour_ranks[grid.comm().rank()] > 0);
+    } else {
+        BOOST_CHECK_EQUAL(report.edge_cut, std::size_t(0));
+    }
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(nncOverlap)
+{
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+
+    // Connect opposite corners of the box and the two layers at the far ends.
+    std::vector<Dune::cpgrid::NonNeighbourConnection> nncs = {
+        { 0, 8*4*2 - 1, 1.0 },
+        { 7, 8*4 + 24, 0.5 },
+        { 3, 8*4 + 31, 0.5 }
+    };
+    grid.loadBalance(nullptr, nullptr, nncs);
+
+    std::set<int> local_cells(grid.globalCell().begin(), grid.globalCell().end());
+    std::set<int> owned_cells;
+    const auto& view = grid.leafGridView();
+    for (auto it = view.begin<0, Dune::Interior_Partition>();
+         it != view.end<0, Dune::Interior_Partition>(); ++it) {
+        owned_cells.insert(grid.globalCell()[it->index()]);
+    }
+    for (const auto& nnc : nncs) {
+        if (owned_cells.count(nnc.cell1)) {
+            BOOST_CHECK(local_cells.count(nnc.cell2));
+        }
+        if (owned_cells.count(nnc.cell2)) {
+            BOOST_CHECK(local_cells.count(nnc.cell1));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(partitionFile)
+{
+    const std::string filename = "distribution_test_partition.bin";
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+
+    // The first grid computes the partition and stores it,
+    // the second one has to read and use it.
+    std::vector<std::set<int> > owned_cells(2);
+    for (auto& owned : owned_cells) {
+        Dune::CpGrid grid;
+        grid.createCartesian(dims, size);
+        grid.setPartitionFile(filename);
+        grid.loadBalance();
+        const auto& view = grid.leafGridView();
+        for (auto it = view.begin<0, Dune::Interior_Partition>();
+             it != view.end<0, Dune::Interior_Partition>(); ++it) {
+            owned.insert(grid.globalCell()[it->index()]);
+        }
+    }
+    BOOST_CHECK(owned_cells[0] == owned_cells[1]);
+
+#if HAVE_MPI
+    const auto& cc = Dune::MPIHelper::getCollectiveCommunication();
+    if (cc.rank() == 0) {
+        std::vector<int> cell_part;
+        int num_parts = 0;
+        BOOST_CHECK(!Dune::cpgrid::readPartition(filename, 0, 8*4*2, cell_part, num_parts));
+        std::remove(filename.c_str());
+    }
+#endif
+}
+
+#if HAVE_MPI
+BOOST_AUTO_TEST_CASE(partitionFileIsApplied)
+{
+    const std::string filename = "distribution_test_partition_applied.bin";
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, size);
+    grid.setPartitionFile(filename);
+
+    // Stripes along x in reverse rank order, which Zoltan would not compute.
+    const auto& cc = Dune::MPIHelper::getCollectiveCommunication();
+    const auto expected_part = [&](int cartesian_index) {
+        const int i = cartesian_index % dims[0];
+        return cc.size() - 1 - i * cc.size() / dims[0];
+    };
+    const auto node_of_rank = Dune::cpgrid::computeNodeTopology(cc).node_of_rank;
+    if (cc.rank() == 0) {
+        std::vector<int> cell_part(grid.numCells());
+        for (int c = 0; c < grid.numCells(); ++c) {
+            cell_part[c] = expected_part(grid.globalCell()[c]);
+        }
+        const auto hash = Dune::cpgrid::partitionHash(grid, Dune::cpgrid::WellConnections(),
+                                                      {}, nullptr, cc.size(), false,
+                                                      node_of_rank);
+        Dune::cpgrid::writePartition(filename, hash, cell_part, cc.size());
+    }
+    cc.barrier();
+    grid.loadBalance();
+
+    const auto& view = grid.leafGridView();
+    int owned = 0;
+    for (auto it = view.begin<0, Dune::Interior_Partition>();
+         it != view.end<0, Dune::Interior_Partition>(); ++it, ++owned) {
+        BOOST_CHECK_EQUAL(expected_part(grid.globalCell()[it->index()]), cc.rank());
+    }
+    BOOST_CHECK_EQUAL(cc.sum(owned), dims[0]*dims[1]*dims[2]);
+    if (cc.rank() == 0) {
+        std::remove(filename.c_str());
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(partitionFileDependsOnNodes)
+{
+    const std::string filename = "distribution_test_partition_nodes.bin";
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    const Dune::cpgrid::WellConnections wells;
+    const std::vector<Dune::cpgrid::NonNeighbourConnection> nncs;
+    auto hash = [&](bool node_aware, const std::vector<int>& node_of_rank) {
+        return Dune::cpgrid::partitionHash(grid, wells, nncs, nullptr, 4,
+                                           node_aware, node_of_rank);
+    };
+
+    // A partition stored in flat mode on two nodes is only reused in
+    // flat mode on the same nodes.
+    const std::vector<int> two_nodes = { 0, 0, 1, 1 };
+    const std::vector<int> interleaved = { 0, 1, 0, 1 };
+    const std::vector<int> one_node = { 0, 0, 0, 0 };
+    BOOST_CHECK_EQUAL(hash(false, two_nodes), hash(false, two_nodes));
+    BOOST_CHECK_NE(hash(false, two_nodes), hash(true, two_nodes));
+    BOOST_CHECK_NE(hash(false, two_nodes), hash(false, interleaved));
+    BOOST_CHECK_NE(hash(false, two_nodes), hash(false, one_node));
+    BOOST_CHECK_NE(hash(true, two_nodes), hash(true, interleaved));
+
+    const auto& cc = Dune::MPIHelper::getCollectiveCommunication();
+    if (cc.rank() == 0) {
+        std::vector<int> cell_part(grid.numCells());
+        for (int c = 0; c < grid.numCells(); ++c) {
+            cell_part[c] = c % 4;
+        }
+        Dune::cpgrid::writePartition(filename, hash(false, two_nodes), cell_part, 4);
+        std::vector<int> read_part;
+        int num_parts = 0;
+        BOOST_CHECK(Dune::cpgrid::readPartition(filename, hash(false, two_nodes),
+                                                grid.numCells(), read_part, num_parts));
+        BOOST_CHECK(read_part == cell_part);
+        BOOST_CHECK(!Dune::cpgrid::readPartition(filename, hash(true, two_nodes),
+                                                 grid.numCells(), read_part, num_parts));
+        BOOST_CHECK(!Dune::cpgrid::readPartition(filename, hash(false, interleaved),
+                                                 grid.numCells(), read_part, num_parts));
+        std::remove(filename.c_str());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(nodeAwarePartitioning)
+{
+    const auto topology = Dune::cpgrid::makeNodeTopology({ 0, 0, 1, 0, 1 });
+    BOOST_CHECK_EQUAL(topology.numNodes(), 2);
+    BOOST_CHECK(topology.ranks_per_node == std::vector<int>({ 3, 2 }));
+    BOOST_CHECK(topology.rank_on_node == std::vector<int>({ 0, 1, 0, 2, 1 }));
+
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    grid.createCartesian(dims, size);
+    grid.setNodeAwarePartitioning(true);
+    grid.loadBalance();
+
+#if HAVE_MPI
+    const auto& report = grid.partitionQualityReport();
+    BOOST_CHECK_EQUAL(std::accumulate(report.owned_cells.begin(),
+                                      report.owned_cells.end(), 0), 8*4*2);
+    BOOST_CHECK(report.inter_node_edge_cut <= report.edge_cut);
+    const auto nodes = Dune::cpgrid::computeNodeTopology(MPI_COMM_WORLD);
+    if (nodes.numNodes() == 1) {
+        BOOST_CHECK_EQUAL(report.inter_node_edge_cut, std::size_t(0));
+    }
+#endif
+}
+
+#if HAVE_MPI && defined(HAVE_ZOLTAN)
+BOOST_AUTO_TEST_CASE(hierarchicalPartitioning)
+{
+    const auto& cc = Dune::MPIHelper::getCollectiveCommunication();
+    // Needs at least two pretended nodes with two processes each.
+    if (cc.size() < 4 || cc.size() % 2 != 0) {
+        return;
+    }
+    Dune::CpGrid grid;
+    std::array<int, 3> dims={{16, 8, 2}};
+    std::array<double, 3> size={{ 16.0, 8.0, 2.0}};
+    grid.createCartesian(dims, size);
+
+    // Neighbouring ranks on different nodes, so that a flat partition
+    // cuts mostly between nodes.
+    std::vector<int> node_of_rank(cc.size());
+    for (int rank = 0; rank < cc.size(); ++rank) {
+        node_of_rank[rank] = rank % 2;
+    }
+    const auto nodes = Dune::cpgrid::makeNodeTopology(node_of_rank);
+    auto interNodeCut = [&](const std::vector<int>& cell_part) {
+        int cut = 0;
+        for (int f = 0; f < grid.numFaces(); ++f) {
+            const int c0 = grid.faceCell(f, 0);
+            const int c1 = grid.faceCell(f, 1);
+            if (c0 >= 0 && c1 >= 0
+                && node_of_rank[cell_part[c0]] != node_of_rank[cell_part[c1]]) {
+                ++cut;
+            }
+        }
+        return cut;
+    };
+    const auto flat = std::get<0>(Dune::cpgrid::zoltanGraphPartitionGridOnRoot(grid, nullptr, nullptr,
+                                                                              cc, 0));
+    const auto hierarchical =
+        std::get<0>(Dune::cpgrid::zoltanGraphPartitionGridOnRoot(grid, nullptr, nullptr, cc, 0,
+                                                                 nullptr, &nodes));
+    BOOST_CHECK_LT(interNodeCut(hierarchical), interNodeCut(flat));
+
+    // Each pretended node gets half of the cells.
+    std::vector<int> cells_per_node(2, 0);
+    for (int part : hierarchical) {
+        ++cells_per_node[node_of_rank[part]];
+    }
+    BOOST_CHECK_EQUAL(cells_per_node[0] + cells_per_node[1], grid.numCells());
+    BOOST_CHECK(std::abs(cells_per_node[0] - cells_per_node[1]) <= grid.numCells() / 10);
+}
+#endif
+
+#if HAVE_MPI
+BOOST_AUTO_TEST_CASE(nodeSharedInput)
+{
+    Opm::SyntheticCornerPointParameters params;
+    params.dims = {{ 6, 5, 4 }};
+    params.fault_density = 0.3;
+    params.fault_throw = 0.5;
+    params.inactive_fraction = 0.1;
+    const Opm::SyntheticCornerPointModel model(params);
+
+    // Only rank 0 provides the input.
+    grdecl input{};
+    if (Dune::MPIHelper::getCollectiveCommunication().rank() == 0) {
+        input = model.input();
+    }
+    Dune::cpgrid::NodeSharedGrdecl shared(input, MPI_COMM_WORLD);
+    Dune::CpGrid grid;
+    grid.processEclipseFormat(shared, 0.0, false);
+    grid.loadBalance();
+    // Only process 0 keeps the global grid.
+    DummyDataHandle handle;
+    BOOST_CHECK_THROW(grid.scatterData(handle), std::logic_error);
+
+    // The same partition as a grid read on every process.
+    Dune::CpGrid reference;
+    reference.processEclipseFormat(model.input(), 0.0, false);
+    const int num_global_cells = reference.numCells();
+    reference.loadBalance();
+    BOOST_CHECK_EQUAL(std::accumulate(grid.partitionQualityReport().owned_cells.begin(),
+                                      grid.partitionQualityReport().owned_cells.end(), 0),
+                      num_global_cells);
+    BOOST_REQUIRE_EQUAL(grid.numCells(), reference.numCells());
+    BOOST_REQUIRE_EQUAL(grid.numFaces(), reference.numFaces());
+    BOOST_CHECK(grid.globalCell() == reference.globalCell());
+    for (int c = 0; c < grid.numCells(); ++c) {
+        BOOST_CHECK_CLOSE(grid.cellVolume(c), reference.cellVolume(c), 1e-10);
+    }
+    for (int f = 0; f < grid.numFaces(); ++f) {
+        BOOST_CHECK_CLOSE(grid.faceArea(f), reference.faceArea(f), 1e-10);
+    }
+}
+#endif
+
+#if HAVE_MPI
+BOOST_AUTO_TEST_CASE(checkpoint)
+{
+    const std::string directory = "distribution_test_checkpoint";
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, size);
+    BOOST_CHECK_THROW(grid.writeCheckpoint(directory), std::logic_error);
+    grid.loadBalance();
+    grid.writeCheckpoint(directory);
+
+    Dune::CpGrid restored;
+    restored.readCheckpoint(directory);
+    const auto& cc = grid.comm();
+    std::remove((directory + "/rank-" + std::to_string(cc.rank()) + ".grid").c_str());
+    cc.barrier();
+    if (cc.rank() == 0) {
+        std::remove(directory.c_str());
+    }
+
+    BOOST_REQUIRE_EQUAL(restored.numCells(), grid.numCells());
+    BOOST_REQUIRE_EQUAL(restored.numFaces(), grid.numFaces());
+    BOOST_REQUIRE_EQUAL(restored.numVertices(), grid.numVertices());
+    BOOST_CHECK(restored.globalCell() == grid.globalCell());
+    BOOST_CHECK(restored.comm().size() == cc.size());
+
+    const auto& view = restored.leafGridView();
+    const auto& original_view = grid.leafGridView();
+    BOOST_CHECK_EQUAL(view.size(0), original_view.size(0));
+    auto original = original_view.begin<0>();
+    for (auto it = view.begin<0>(); it != view.end<0>(); ++it, ++original) {
+        BOOST_CHECK_EQUAL(it->partitionType(), original->partitionType());
+        BOOST_CHECK_EQUAL(restored.globalIdSet().id(*it), grid.globalIdSet().id(*original));
+    }
+    int interior = 0;
+    for (auto it = view.begin<0, Dune::Interior_Partition>();
+         it != view.end<0, Dune::Interior_Partition>(); ++it) {
+        ++interior;
+    }
+    BOOST_CHECK_EQUAL(cc.sum(interior), dims[0]*dims[1]*dims[2]);
+
+    // The restored interfaces have to deliver the ids of the neighbours.
+    std::vector<int> point_ids(restored.numVertices(), -1), cell_ids(restored.numCells(), -1);
+    LoadBalanceGlobalIdDataHandle data(restored.globalIdSet(), restored, point_ids, cell_ids);
+    restored.communicate(data, Dune::All_All_Interface, Dune::ForwardCommunication);
+    for (auto it = view.begin<0>(); it != view.end<0>(); ++it) {
+        const int received = cell_ids[view.indexSet().index(*it)];
+        BOOST_CHECK(received == -1 || received == restored.globalIdSet().id(*it));
+    }
+    for (auto it = view.begin<3>(); it != view.end<3>(); ++it) {
+        const int received = point_ids[view.indexSet().index(*it)];
+        BOOST_CHECK(received == -1 || received == restored.globalIdSet().id(*it));
+    }
+
+    // There is no global grid to scatter from or gather to.
+    DummyDataHandle handle;
+    BOOST_CHECK_THROW(restored.scatterData(handle), std::logic_error);
+    BOOST_CHECK_THROW(restored.gatherData(handle), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(cartesianCellData)
+{
+    const std::string filename = "distribution_test_cartesian.bin";
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, size);
+    grid.loadBalance();
+    const auto& cc = grid.comm();
+
+    std::vector<double> data(grid.numCells());
+    for (int c = 0; c < grid.numCells(); ++c) {
+        data[c] = 0.5 * grid.globalCell()[c];
+    }
+    const int num_cells = dims[0]*dims[1]*dims[2];
+    for (int num_aggregators : { 1, 2, cc.size() }) {
+        grid.writeCartesianCellData(data, filename, num_aggregators, -1.0);
+        cc.barrier();
+        std::vector<double> written(num_cells + 1, -2.0);
+        {
+            std::ifstream file(filename, std::ios::binary);
+            file.read(reinterpret_cast<char*>(written.data()), written.size() * sizeof(double));
+            BOOST_CHECK_EQUAL(file.gcount(), std::streamsize(num_cells * sizeof(double)));
+        }
+        for (int i = 0; i < num_cells; ++i) {
+            BOOST_CHECK_EQUAL(written[i], 0.5 * i);
+        }
+        cc.barrier();
+    }
+
+    // Every process holds the global view, yet each cell is written once.
+    grid.switchToGlobalView();
+    std::vector<double> global_data(grid.numCells());
+    for (int c = 0; c < grid.numCells(); ++c) {
+        global_data[c] = 2.0 * grid.globalCell()[c];
+    }
+    grid.writeCartesianCellData(global_data, filename, cc.size(), -1.0);
+    cc.barrier();
+    {
+        std::vector<double> written(num_cells);
+        std::ifstream file(filename, std::ios::binary);
+        file.read(reinterpret_cast<char*>(written.data()), written.size() * sizeof(double));
+        for (int i = 0; i < num_cells; ++i) {
+            BOOST_CHECK_EQUAL(written[i], 2.0 * i);
+        }
+    }
+    grid.switchToDistributedView();
+    cc.barrier();
+
+    if (cc.rank() == 0) {
+        std::remove(filename.c_str());
+    }
+    BOOST_CHECK_THROW(grid.writeCartesianCellData(std::vector<double>(1), filename),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(grid.writeCartesianCellData(data, "no_such_directory/" + filename),
+                      std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(asyncCellGather)
+{
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, size);
+    grid.loadBalance();
+    const auto& cc = grid.comm();
+    const int num_cells = dims[0]*dims[1]*dims[2];
+
+    std::vector<std::vector<double>> gathered;
+    {
+        Dune::cpgrid::AsyncCellGather<double> gather(grid, 0, 2);
+        std::vector<double> data(grid.numCells());
+        const auto& view = grid.leafGridView();
+        for (int step = 0; step < 5; ++step) {
+            for (auto it = view.begin<0>(); it != view.end<0>(); ++it) {
+                data[view.indexSet().index(*it)] = grid.globalIdSet().id(*it) + 1000.0 * step;
+            }
+            gather.gather(data, [&gathered](const std::vector<double>& global) {
+                gathered.push_back(global);
+            });
+            // The values are copied, so they may be changed right away.
+            std::fill(data.begin(), data.end(), -1.0);
+            gather.progress();
+        }
+        gather.wait();
+
+        if (cc.rank() == 0) {
+            BOOST_REQUIRE_EQUAL(gathered.size(), 5u);
+            for (int step = 0; step < 5; ++step) {
+                BOOST_REQUIRE_EQUAL(gathered[step].size(), std::size_t(num_cells));
+                for (int i = 0; i < num_cells; ++i) {
+                    BOOST_CHECK_EQUAL(gathered[step][i], i + 1000.0 * step);
+                }
+            }
+        } else {
+            BOOST_CHECK(gathered.empty());
+        }
+
+        gather.gather(data, [](const std::vector<double>&) {
+            throw std::runtime_error("Writing failed");
+        });
+        if (cc.rank() == 0) {
+            BOOST_CHECK_THROW(gather.wait(), std::runtime_error);
+        } else {
+            gather.wait();
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(scatterCellProperty)
+{
+    std::array<int, 3> dims={{8, 4, 2}};
+    std::array<double, 3> size={{ 8.0, 4.0, 2.0}};
+    const std::size_t num_cells = dims[0]*dims[1]*dims[2];
+
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, size);
+    std::size_t next = 0;
+    bool chunks_ok = true;
+    auto producer = [&](std::size_t begin, std::size_t end, double* out) {
+        chunks_ok = chunks_ok && begin == next && end > begin && end - begin <= 7;
+        next = end;
+        for (std::size_t i = begin; i < end; ++i) {
+            out[i - begin] = 2.0 * i + 0.5;
+        }
+    };
+
+    // Without a distributed view every process fills its cells itself.
+    std::vector<double> values;
+    grid.scatterCellProperty(producer, values, 7);
+    BOOST_CHECK(chunks_ok);
+    BOOST_CHECK_EQUAL(next, num_cells);
+    BOOST_REQUIRE_EQUAL(values.size(), num_cells);
+    for (std::size_t c = 0; c < num_cells; ++c) {
+        BOOST_CHECK_EQUAL(values[c], 2.0 * grid.globalCell()[c] + 0.5);
+    }
+
+    grid.loadBalance();
+    next = 0;
+    grid.scatterCellProperty(producer, values, 7);
+    BOOST_CHECK(chunks_ok);
+    // Only process 0 produces the values.
+    BOOST_CHECK_EQUAL(next, grid.comm().rank() == 0 ? num_cells : 0);
+    BOOST_REQUIRE_EQUAL(values.size(), std::size_t(grid.numCells()));
+    // Including the overlap cells.
+    for (int c = 0; c < grid.numCells(); ++c) {
+        BOOST_CHECK_EQUAL(values[c], 2.0 * grid.globalCell()[c] + 0.5);
+    }
+}
+#endif
+
 bool
 init_unit_test_func()
 {
@@ -0,0 +1,198 @@
+#include <config.h>
+
+#define NVERBOSE // to suppress our messages when throwing
+
+#define BOOST_TEST_MODULE EGridReaderTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/common/EGridReader.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /// Writes unformatted Eclipse arrays as big-endian Fortran records
+    /// of at most 1000 elements.
+    class EGridWriter
+    {
+    public:
+        explicit EGridWriter(const std::string& filename)
+            : file_(filename, std::ios::binary)
+        {
+        }
+
+        void writeInts(const std::string& keyword, const std::vector<int>& values,
+                       const std::string& type = "INTE")
+        {
+            std::vector<std::uint32_t> words(values.begin(), values.end());
+            writeArray(keyword, type, words);
+        }
+
+        void writeFloats(const std::string& keyword, const std::vector<double>& values)
+        {
+            std::vector<std::uint32_t> words;
+            for (double v : values) {
+                const float f = static_cast<float>(v);
+                std::uint32_t word;
+                std::memcpy(&word, &f, 4);
+                words.push_back(word);
+            }
+            writeArray(keyword, "REAL", words);
+        }
+
+        void writeChars(const std::string& keyword, const std::string& value)
+        {
+            writeHeader(keyword, 1, "CHAR");
+            writeMarker(8);
+            file_.write((value + "        ").c_str(), 8);
+            writeMarker(8);
+        }
+
+    private:
+        void writeMarker(std::uint32_t value)
+        {
+            writeWord(value);
+        }
+
+        void writeWord(std::uint32_t value)
+        {
+            const char bytes[4] = { char(value >> 24), char(value >> 16),
+                                    char(value >> 8), char(value) };
+            file_.write(bytes, 4);
+        }
+
+        void writeHeader(const std::string& keyword, std::size_t count, const std::string& type)
+        {
+            writeMarker(16);
+            file_.write((keyword + "        ").c_str(), 8);
+            writeWord(count);
+            file_.write(type.c_str(), 4);
+            writeMarker(16);
+        }
+
+        void writeArray(const std::string& keyword, const std::string& type,
+                        const std::vector<std::uint32_t>& words)
+        {
+            writeHeader(keyword, words.size(), type);
+            for (std::size_t start = 0; start < words.size(); start += 1000) {
+                const std::size_t n = std::min(std::size_t(1000), words.size() - start);
+                writeMarker(4*n);
+                for (std::size_t i = start; i < start + n; ++i) {
+                    writeWord(words[i]);
+                }
+                writeMarker(4*n);
+            }
+        }
+
+        std::ofstream file_;
+    };
+
+    const int nx = 6, ny = 5, nz = 4;
+
+    std::vector<double> makeCoord()
+    {
+        std::vector<double> coord;
+        for (int j = 0; j <= ny; ++j) {
+            for (int i = 0; i <= nx; ++i) {
+                const double top[3] = { double(i), double(j), 0.0 };
+                const double bottom[3] = { double(i), double(j), double(nz) };
+                coord.insert(coord.end(), top, top + 3);
+                coord.insert(coord.end(), bottom, bottom + 3);
+            }
+        }
+        return coord;
+    }
+
+    std::vector<double> makeZcorn()
+    {
+        std::vector<double> zcorn;
+        for (int k = 0; k < 2*nz; ++k) {
+            for (int n = 0; n < 4*nx*ny; ++n) {
+                zcorn.push_back((k + 1) / 2);
+            }
+        }
+        return zcorn;
+    }
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(readMainGrid)
+{
+    const std::string filename = "egridreader_test.EGRID";
+    const std::vector<double> coord = makeCoord();
+    const std::vector<double> zcorn = makeZcorn();
+    std::vector<int> actnum(nx*ny*nz, 1);
+    actnum[7] = 0;
+    const std::vector<double> mapaxes = { 0.0, 1.0, 0.0, 0.0, 1.0, 0.0 };
+    {
+        EGridWriter writer(filename);
+        writer.writeInts("FILEHEAD", std::vector<int>(100, 3));
+        writer.writeChars("MAPUNITS", "METRES");
+        writer.writeFloats("MAPAXES", mapaxes);
+        writer.writeInts("GRIDHEAD", { 1, nx, ny, nz, 0 });
+        writer.writeFloats("COORD", coord);
+        writer.writeFloats("ZCORN", zcorn);
+        writer.writeInts("ACTNUM", actnum);
+        writer.writeInts("ENDGRID", {});
+        // A local grid refinement, which is skipped.
+        writer.writeChars("LGR", "LGR1");
+        writer.writeInts("GRIDHEAD", { 1, 2, 2, 2, 0 });
+        writer.writeFloats("COORD", std::vector<double>(54, 1.0));
+        writer.writeInts("ENDLGR", {});
+        writer.writeInts("NNCHEAD", { 2, 0 });
+        writer.writeInts("NNC1", { 1, 5 });
+        writer.writeInts("NNC2", { 31, 120 });
+        writer.writeInts("NNCHEAD", { 1, 1 });
+        writer.writeInts("NNC1", { 2 });
+        writer.writeInts("NNC2", { 3 });
+    }
+
+    Dune::cpgrid::EGridReader reader(filename);
+    std::remove(filename.c_str());
+
+    const grdecl& input = reader.input();
+    BOOST_CHECK_EQUAL(input.dims[0], nx);
+    BOOST_CHECK_EQUAL(input.dims[1], ny);
+    BOOST_CHECK_EQUAL(input.dims[2], nz);
+    BOOST_CHECK_EQUAL_COLLECTIONS(input.coord, input.coord + coord.size(),
+                                  coord.begin(), coord.end());
+    // ZCORN is longer than one record.
+    BOOST_CHECK_EQUAL_COLLECTIONS(input.zcorn, input.zcorn + zcorn.size(),
+                                  zcorn.begin(), zcorn.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(input.actnum, input.actnum + actnum.size(),
+                                  actnum.begin(), actnum.end());
+    BOOST_REQUIRE(input.mapaxes != nullptr);
+    BOOST_CHECK_EQUAL(input.mapaxes[1], 1.0);
+
+    const auto& nncs = reader.nncs();
+    BOOST_REQUIRE_EQUAL(nncs.size(), 2u);
+    BOOST_CHECK_EQUAL(nncs[0].cell1, 0);
+    BOOST_CHECK_EQUAL(nncs[0].cell2, 30);
+    BOOST_CHECK_EQUAL(nncs[1].cell1, 4);
+    BOOST_CHECK_EQUAL(nncs[1].cell2, 119);
+
+    processed_grid grid;
+    process_grdecl(&input, 0.0, &grid);
+    BOOST_CHECK_EQUAL(grid.number_of_cells, nx*ny*nz - 1);
+    free_processed_grid(&grid);
+}
+
+BOOST_AUTO_TEST_CASE(invalidFiles)
+{
+    BOOST_CHECK_THROW(Dune::cpgrid::EGridReader("egridreader_test_missing.EGRID"),
+                      std::runtime_error);
+
+    const std::string filename = "egridreader_test_truncated.EGRID";
+    {
+        EGridWriter writer(filename);
+        writer.writeInts("GRIDHEAD", { 1, nx, ny, nz, 0 });
+    }
+    BOOST_CHECK_THROW(Dune::cpgrid::EGridReader reader(filename), std::runtime_error);
+    std::remove(filename.c_str());
+}
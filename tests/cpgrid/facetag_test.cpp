@@ -93,6 +93,31 @@ BOOST_AUTO_TEST_CASE(facetag)
     }
 }
 
+BOOST_AUTO_TEST_CASE(facecells)
+{
+    int m_argc = boost::unit_test::framework::master_test_suite().argc;
+    char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+    Dune::MPIHelper::instance(m_argc, m_argv);
+    Dune::CpGrid grid;
+    std::array<int, 3>    dims     = { 3, 3, 3 };
+    std::array<double, 3> cellsize = { 1., 1., 1. };
+    grid.createCartesian(dims, cellsize);
+    auto face_cells = Opm::UgGridHelpers::faceCells(grid);
+    const int* raw_face_cells = grid.faceCells();
+
+    for( int face=0; face < grid.numFaces(); ++face)
+    {
+        auto c0 = grid.faceCell(face, 0), c1 = grid.faceCell(face, 1);
+        BOOST_CHECK( c0 >= 0 || c1 >= 0 );
+        BOOST_CHECK_EQUAL( face_cells(face, 0), c0 );
+        BOOST_CHECK_EQUAL( face_cells(face, 1), c1 );
+        BOOST_CHECK_EQUAL( face_cells[face][0], c0 );
+        BOOST_CHECK_EQUAL( face_cells[face][1], c1 );
+        BOOST_CHECK_EQUAL( raw_face_cells[2*face], c0 );
+        BOOST_CHECK_EQUAL( raw_face_cells[2*face+1], c1 );
+    }
+}
+
 bool
 init_unit_test_func()
 {
@@ -116,8 +116,15 @@ BOOST_AUTO_TEST_CASE(cellgeom)
 //     for (int i = 0; i < 8; ++i) {
 //         std::cout << corners[i] << std::endl;
 //     }
+    // The cell corners are read from the vertex geometries.
+    cpgrid::Geometry<0, 3> vertices[8];
+    for (int i = 0; i < 8; ++i) {
+        vertices[i] = cpgrid::Geometry<0, 3>(corners[i]);
+    }
     int cor_idx[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
-    Geometry g(c, v, corners, cor_idx);
+    Geometry g(c, v, vertices, cor_idx);
+    BOOST_CHECK(g.hasCorners());
+    BOOST_CHECK(!g_dangerous.hasCorners());
 
     // Verification of properties.
     BOOST_CHECK(g.type().isCube());
@@ -162,7 +169,9 @@ BOOST_AUTO_TEST_CASE(cellgeom)
     v = 0.5;
     corners[5][2] = 0.0;
     corners[7][2] = 0.0;
-    g = Geometry(c, v, corners, cor_idx);
+    vertices[5] = cpgrid::Geometry<0, 3>(corners[5]);
+    vertices[7] = cpgrid::Geometry<0, 3>(corners[7]);
+    g = Geometry(c, v, vertices, cor_idx);
 
     // Verification of properties.
     BOOST_CHECK(g.type().isCube());
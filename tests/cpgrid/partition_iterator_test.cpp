@@ -58,6 +58,35 @@ void testPartitionIteratorsOnSequentialGrid(const Dune::CpGrid& grid)
     BOOST_REQUIRE((ait==grid.leafend<codim,Dune::All_Partition>()));
 }
 
+template<int codim, Dune::PartitionIteratorType pitype, class Predicate>
+void testPartitionIteratorMatchesPartitionType(const Dune::CpGrid& grid, Predicate inPartition)
+{
+    typedef typename Dune::CpGrid::Traits::template Codim<codim>::template Partition<pitype>::LeafIterator PLeafIterator;
+    typedef typename Dune::CpGrid::Traits::template Codim<codim>::template Partition<Dune::All_Partition>::LeafIterator ALeafIterator;
+    PLeafIterator pit=grid.leafbegin<codim,pitype>();
+    for(ALeafIterator ait=grid.leafbegin<codim,Dune::All_Partition>();
+        ait!=grid.leafend<codim,Dune::All_Partition>(); ++ait)
+    {
+        if(inPartition(ait->partitionType()))
+        {
+            BOOST_REQUIRE((pit!=grid.leafend<codim,pitype>()));
+            BOOST_REQUIRE((*pit==*ait));
+            ++pit;
+        }
+    }
+    BOOST_REQUIRE((pit==grid.leafend<codim,pitype>()));
+}
+
+template<int codim>
+void testPartitionIteratorsMatchPartitionType(const Dune::CpGrid& grid)
+{
+    testPartitionIteratorMatchesPartitionType<codim,Dune::Interior_Partition>
+        (grid, [](Dune::PartitionType t){ return t==Dune::InteriorEntity; });
+    testPartitionIteratorMatchesPartitionType<codim,Dune::InteriorBorder_Partition>
+        (grid, [](Dune::PartitionType t){ return t==Dune::InteriorEntity || t==Dune::BorderEntity; });
+    testPartitionIteratorMatchesPartitionType<codim,Dune::Overlap_Partition>
+        (grid, [](Dune::PartitionType t){ return t!=Dune::FrontEntity; });
+}
 
 BOOST_AUTO_TEST_CASE(partitionIteratorTest)
 {
@@ -90,6 +119,8 @@ BOOST_AUTO_TEST_CASE(partitionIteratorTest)
     testPartitionIteratorsBasic<0>(grid, parallel);
     testPartitionIteratorsBasic<1>(grid, parallel);
     testPartitionIteratorsBasic<3>(grid, parallel);
+    testPartitionIteratorsMatchPartitionType<0>(grid);
+    testPartitionIteratorsMatchPartitionType<3>(grid);
     if(!parallel)
     {
         testPartitionIteratorsOnSequentialGrid<0>(grid);
@@ -0,0 +1,100 @@
+#include <config.h>
+
+#define NVERBOSE // to suppress our messages when throwing
+
+#define BOOST_TEST_MODULE ReorderForLocalityTests
+#define BOOST_TEST_NO_MAIN
+#include <boost/test/unit_test.hpp>
+#include <opm/grid/CpGrid.hpp>
+
+#include <array>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(reorderForLocality)
+{
+    int m_argc = boost::unit_test::framework::master_test_suite().argc;
+    char** m_argv = boost::unit_test::framework::master_test_suite().argv;
+    Dune::MPIHelper::instance(m_argc, m_argv);
+
+    std::array<int, 3>    dims     = {{ 4, 3, 2 }};
+    std::array<double, 3> cellsize = {{ 1., 2., 3. }};
+    Dune::CpGrid original;
+    original.createCartesian(dims, cellsize);
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, cellsize);
+    BOOST_CHECK(grid.originalIndices(0).empty());
+
+    grid.reorderForLocality();
+
+    BOOST_REQUIRE_EQUAL(grid.numCells(), original.numCells());
+    BOOST_REQUIRE_EQUAL(grid.numFaces(), original.numFaces());
+    BOOST_REQUIRE_EQUAL(grid.numVertices(), original.numVertices());
+    const auto& cell_orig = grid.originalIndices(0);
+    const auto& face_orig = grid.originalIndices(1);
+    const auto& point_orig = grid.originalIndices(3);
+    BOOST_REQUIRE_EQUAL(cell_orig.size(), std::size_t(grid.numCells()));
+    BOOST_REQUIRE_EQUAL(face_orig.size(), std::size_t(grid.numFaces()));
+    BOOST_REQUIRE_EQUAL(point_orig.size(), std::size_t(grid.numVertices()));
+
+    for (int c = 0; c < grid.numCells(); ++c) {
+        const int oc = cell_orig[c];
+        BOOST_CHECK_EQUAL(grid.globalCell()[c], original.globalCell()[oc]);
+        BOOST_CHECK_CLOSE(grid.cellVolume(c), original.cellVolume(oc), 1e-10);
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(grid.cellCentroid(c)[d] + 1.0, original.cellCentroid(oc)[d] + 1.0, 1e-10);
+        }
+        BOOST_REQUIRE_EQUAL(grid.numCellFaces(c), original.numCellFaces(oc));
+        for (int f = 0; f < grid.numCellFaces(c); ++f) {
+            BOOST_CHECK_EQUAL(face_orig[grid.cellFace(c, f)], original.cellFace(oc, f));
+        }
+    }
+
+    // The cell geometries have to follow the renumbered corners.
+    std::vector<Dune::cpgrid::Geometry<3, 3> > original_geometries;
+    for (auto it = original.leafbegin<0>(); it != original.leafend<0>(); ++it) {
+        original_geometries.push_back(it->geometry());
+    }
+    int c = 0;
+    for (auto it = grid.leafbegin<0>(); it != grid.leafend<0>(); ++it, ++c) {
+        const auto& ogeom = original_geometries[cell_orig[c]];
+        for (int corner = 0; corner < 8; ++corner) {
+            for (int d = 0; d < 3; ++d) {
+                BOOST_CHECK_CLOSE(it->geometry().corner(corner)[d] + 1.0,
+                                  ogeom.corner(corner)[d] + 1.0, 1e-10);
+            }
+        }
+    }
+
+    for (int f = 0; f < grid.numFaces(); ++f) {
+        const int of = face_orig[f];
+        for (int local = 0; local < 2; ++local) {
+            const int cell = grid.faceCell(f, local);
+            const int ocell = original.faceCell(of, local);
+            BOOST_CHECK_EQUAL(cell < 0 ? -1 : cell_orig[cell], ocell);
+        }
+        BOOST_REQUIRE_EQUAL(grid.numFaceVertices(f), original.numFaceVertices(of));
+        for (int v = 0; v < grid.numFaceVertices(f); ++v) {
+            BOOST_CHECK_EQUAL(point_orig[grid.faceVertex(f, v)], original.faceVertex(of, v));
+        }
+    }
+
+    for (int v = 0; v < grid.numVertices(); ++v) {
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(grid.vertexPosition(v)[d] + 1.0,
+                              original.vertexPosition(point_orig[v])[d] + 1.0, 1e-10);
+        }
+    }
+}
+
+bool
+init_unit_test_func()
+{
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    boost::unit_test::unit_test_main(&init_unit_test_func,
+                                     argc, argv);
+}
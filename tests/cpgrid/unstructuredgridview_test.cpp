@@ -0,0 +1,117 @@
+#include <config.h>
+
+#define NVERBOSE // to suppress our messages when throwing
+
+#define BOOST_TEST_MODULE UnstructuredGridViewTests
+#define BOOST_TEST_NO_MAIN
+#include <boost/test/unit_test.hpp>
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/cpgrid/UnstructuredGridView.hpp>
+#include <opm/grid/UnstructuredGrid.h>
+
+#include <array>
+#include <stdexcept>
+
+BOOST_AUTO_TEST_CASE(view)
+{
+    std::array<int, 3>    dims     = {{ 4, 3, 2 }};
+    std::array<double, 3> cellsize = {{ 1., 2., 3. }};
+    Dune::CpGrid grid;
+    grid.createCartesian(dims, cellsize);
+    const Dune::cpgrid::UnstructuredGridView view(grid);
+    const UnstructuredGrid& ug = view;
+
+    BOOST_REQUIRE_EQUAL(ug.number_of_cells, grid.numCells());
+    BOOST_REQUIRE_EQUAL(ug.number_of_faces, grid.numFaces());
+    BOOST_REQUIRE_EQUAL(ug.number_of_nodes, grid.numVertices());
+    BOOST_REQUIRE(ug.cell_facetag != nullptr);
+
+    for (int c = 0; c < ug.number_of_cells; ++c) {
+        BOOST_CHECK_EQUAL(ug.global_cell[c], grid.globalCell()[c]);
+        BOOST_CHECK_CLOSE(ug.cell_volumes[c], grid.cellVolume(c), 1e-10);
+        BOOST_REQUIRE_EQUAL(ug.cell_facepos[c + 1] - ug.cell_facepos[c], grid.numCellFaces(c));
+        for (int f = 0; f < grid.numCellFaces(c); ++f) {
+            BOOST_CHECK_EQUAL(ug.cell_faces[ug.cell_facepos[c] + f], grid.cellFace(c, f));
+        }
+    }
+    for (int f = 0; f < ug.number_of_faces; ++f) {
+        for (int local = 0; local < 2; ++local) {
+            BOOST_CHECK_EQUAL(ug.face_cells[2*f + local], grid.faceCell(f, local));
+        }
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(ug.face_normals[3*f + d] + 1.0,
+                              grid.faceNormal(f)[d]*grid.faceArea(f) + 1.0, 1e-10);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(roundtrip)
+{
+    std::array<int, 3>    dims     = {{ 4, 3, 2 }};
+    std::array<double, 3> cellsize = {{ 1., 2., 3. }};
+    Dune::CpGrid original;
+    original.createCartesian(dims, cellsize);
+
+    Dune::CpGrid grid;
+    {
+        const Dune::cpgrid::UnstructuredGridView view(original);
+        grid.processUnstructuredGrid(view);
+    }
+
+    BOOST_REQUIRE_EQUAL(grid.numCells(), original.numCells());
+    BOOST_REQUIRE_EQUAL(grid.numFaces(), original.numFaces());
+    BOOST_REQUIRE_EQUAL(grid.numVertices(), original.numVertices());
+    BOOST_CHECK(grid.logicalCartesianSize() == original.logicalCartesianSize());
+
+    for (int c = 0; c < grid.numCells(); ++c) {
+        BOOST_CHECK_EQUAL(grid.globalCell()[c], original.globalCell()[c]);
+        BOOST_CHECK_CLOSE(grid.cellVolume(c), original.cellVolume(c), 1e-10);
+    }
+    for (int f = 0; f < grid.numFaces(); ++f) {
+        for (int local = 0; local < 2; ++local) {
+            BOOST_CHECK_EQUAL(grid.faceCell(f, local), original.faceCell(f, local));
+        }
+        BOOST_CHECK_CLOSE(grid.faceArea(f), original.faceArea(f), 1e-10);
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_CLOSE(grid.faceNormal(f)[d] + 1.0, original.faceNormal(f)[d] + 1.0, 1e-10);
+        }
+    }
+
+    // The cell corners are rebuilt from the bottom and top faces.
+    auto oit = original.leafbegin<0>();
+    for (auto it = grid.leafbegin<0>(); it != grid.leafend<0>(); ++it, ++oit) {
+        for (int corner = 0; corner < 8; ++corner) {
+            for (int d = 0; d < 3; ++d) {
+                BOOST_CHECK_CLOSE(it->geometry().corner(corner)[d] + 1.0,
+                                  oit->geometry().corner(corner)[d] + 1.0, 1e-10);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(missingFaceTags)
+{
+    std::array<int, 3>    dims     = {{ 2, 2, 2 }};
+    std::array<double, 3> cellsize = {{ 1., 1., 1. }};
+    Dune::CpGrid original;
+    original.createCartesian(dims, cellsize);
+    const Dune::cpgrid::UnstructuredGridView view(original);
+    UnstructuredGrid ug = view.grid();
+    ug.cell_facetag = nullptr;
+
+    Dune::CpGrid grid;
+    BOOST_CHECK_THROW(grid.processUnstructuredGrid(ug), std::runtime_error);
+}
+
+bool
+init_unit_test_func()
+{
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    boost::unit_test::unit_test_main(&init_unit_test_func,
+                                     argc, argv);
+}
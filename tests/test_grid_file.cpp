@@ -0,0 +1,187 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define NVERBOSE  // Suppress own messages when throw()ing
+
+#define BOOST_TEST_MODULE GridFileTest
+#include <boost/test/unit_test.hpp>
+
+/* --- our own headers --- */
+#include <opm/grid/grid_file.h>
+#include <opm/grid/cart_grid.h>
+#include <opm/grid/UnstructuredGrid.h>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+    template <class T>
+    void checkEqual(const T* a, const T* b, int n)
+    {
+        BOOST_REQUIRE((a == NULL) == (b == NULL));
+        if (a != NULL) {
+            BOOST_CHECK_EQUAL_COLLECTIONS(a, a + n, b, b + n);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE ()
+
+BOOST_AUTO_TEST_CASE (roundtrip)
+{
+    const char* fname = "test_grid_file_roundtrip.grid";
+    struct UnstructuredGrid *g = create_grid_hexa3d(3, 4, 5, 1., 2., 3.);
+    BOOST_REQUIRE(write_grid_binary(g, fname));
+
+    struct UnstructuredGrid *h = read_grid_binary(fname);
+    BOOST_REQUIRE(h != NULL);
+    BOOST_REQUIRE_EQUAL(h->dimensions, g->dimensions);
+    BOOST_REQUIRE_EQUAL(h->number_of_cells, g->number_of_cells);
+    BOOST_REQUIRE_EQUAL(h->number_of_faces, g->number_of_faces);
+    BOOST_REQUIRE_EQUAL(h->number_of_nodes, g->number_of_nodes);
+    const int nc = g->number_of_cells;
+    const int nf = g->number_of_faces;
+    const int dim = g->dimensions;
+    checkEqual(h->cartdims, g->cartdims, 3);
+    checkEqual(h->node_coordinates, g->node_coordinates, dim * g->number_of_nodes);
+    checkEqual(h->face_nodepos, g->face_nodepos, nf + 1);
+    checkEqual(h->face_nodes, g->face_nodes, g->face_nodepos[nf]);
+    checkEqual(h->face_cells, g->face_cells, 2 * nf);
+    checkEqual(h->face_centroids, g->face_centroids, dim * nf);
+    checkEqual(h->face_areas, g->face_areas, nf);
+    checkEqual(h->face_normals, g->face_normals, dim * nf);
+    checkEqual(h->cell_facepos, g->cell_facepos, nc + 1);
+    checkEqual(h->cell_faces, g->cell_faces, g->cell_facepos[nc]);
+    checkEqual(h->cell_facetag, g->cell_facetag, g->cell_facepos[nc]);
+    checkEqual(h->cell_centroids, g->cell_centroids, dim * nc);
+    checkEqual(h->cell_volumes, g->cell_volumes, nc);
+    checkEqual(h->global_cell, g->global_cell, nc);
+
+    destroy_grid(h);
+    destroy_grid(g);
+    std::remove(fname);
+}
+
+BOOST_AUTO_TEST_CASE (mapped)
+{
+    const char* fname = "test_grid_file_mapped.grid";
+    struct UnstructuredGrid *g = create_grid_hexa3d(3, 4, 5, 1., 2., 3.);
+    BOOST_REQUIRE(write_grid_binary(g, fname));
+    const int nc = g->number_of_cells;
+    const int nf = g->number_of_faces;
+    const int dim = g->dimensions;
+
+    struct UnstructuredGrid *h = map_grid_binary(fname, NULL, 0);
+    BOOST_REQUIRE(h != NULL);
+    BOOST_REQUIRE_EQUAL(h->number_of_cells, nc);
+    BOOST_REQUIRE_EQUAL(h->number_of_faces, nf);
+    checkEqual(h->node_coordinates, g->node_coordinates, dim * g->number_of_nodes);
+    checkEqual(h->face_nodes, g->face_nodes, g->face_nodepos[nf]);
+    checkEqual(h->face_cells, g->face_cells, 2 * nf);
+    checkEqual(h->face_normals, g->face_normals, dim * nf);
+    checkEqual(h->cell_faces, g->cell_faces, g->cell_facepos[nc]);
+    checkEqual(h->cell_facetag, g->cell_facetag, g->cell_facepos[nc]);
+    checkEqual(h->cell_centroids, g->cell_centroids, dim * nc);
+    checkEqual(h->global_cell, g->global_cell, nc);
+    unmap_grid_binary(h);
+
+    // Only the requested sections and the offsets are mapped.
+    const char* const names[] = { "face_cells", "cell_volumes" };
+    struct UnstructuredGrid *p = map_grid_binary(fname, names, 2);
+    BOOST_REQUIRE(p != NULL);
+    checkEqual(p->face_nodepos, g->face_nodepos, nf + 1);
+    checkEqual(p->cell_facepos, g->cell_facepos, nc + 1);
+    checkEqual(p->face_cells, g->face_cells, 2 * nf);
+    checkEqual(p->cell_volumes, g->cell_volumes, nc);
+    BOOST_CHECK(p->node_coordinates == NULL);
+    BOOST_CHECK(p->face_nodes == NULL);
+    BOOST_CHECK(p->cell_faces == NULL);
+    BOOST_CHECK(p->cell_centroids == NULL);
+    unmap_grid_binary(p);
+
+    destroy_grid(g);
+    std::remove(fname);
+}
+
+BOOST_AUTO_TEST_CASE (sections)
+{
+    const char* fname = "test_grid_file_sections.grid";
+    const int ints[] = { 1, 2, 3 };
+    const double doubles[] = { 0.5, 1.5 };
+    const struct grid_file_section sections[] = {
+        { "ints",    GRID_FILE_INT32,   3, ints },
+        { "doubles", GRID_FILE_FLOAT64, 2, doubles }
+    };
+    BOOST_REQUIRE(write_grid_file(fname, "test", sections, 2));
+
+    BOOST_CHECK(open_grid_file(fname, "other") == NULL);
+
+    struct grid_file *f = open_grid_file(fname, "test");
+    BOOST_REQUIRE(f != NULL);
+
+    // Sections can be read individually and in any order.
+    size_t count = 0;
+    const double* d = static_cast<const double*>(grid_file_section(f, "doubles", GRID_FILE_FLOAT64, &count));
+    BOOST_REQUIRE(d != NULL);
+    BOOST_CHECK_EQUAL(count, 2u);
+    BOOST_CHECK_EQUAL(d[1], 1.5);
+
+    const int* i = static_cast<const int*>(grid_file_section(f, "ints", GRID_FILE_INT32, &count));
+    BOOST_REQUIRE(i != NULL);
+    BOOST_CHECK_EQUAL(count, 3u);
+    BOOST_CHECK_EQUAL(i[2], 3);
+
+    BOOST_CHECK(grid_file_section(f, "ints", GRID_FILE_FLOAT64, &count) == NULL);
+    BOOST_CHECK(grid_file_section(f, "missing", GRID_FILE_INT32, &count) == NULL);
+    BOOST_CHECK(grid_file_has_section(f, "ints"));
+    BOOST_CHECK(! grid_file_has_section(f, "missing"));
+
+    close_grid_file(f);
+    std::remove(fname);
+}
+
+BOOST_AUTO_TEST_CASE (corrupt)
+{
+    const char* fname = "test_grid_file_corrupt.grid";
+    struct UnstructuredGrid *g = create_grid_cart3d(2, 2, 2);
+    BOOST_REQUIRE(write_grid_binary(g, fname));
+    destroy_grid(g);
+
+    // Flip a byte of the last section.
+    {
+        std::fstream file(fname, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(-1, std::ios::end);
+        char c;
+        file.get(c);
+        file.seekp(-1, std::ios::end);
+        file.put(static_cast<char>(~c));
+    }
+    BOOST_CHECK(read_grid_binary(fname) == NULL);
+
+    // Byte order tag of the header.
+    {
+        std::fstream file(fname, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(8);
+        const char swapped[4] = { 1, 2, 3, 4 };
+        file.write(swapped, 4);
+    }
+    BOOST_CHECK(open_grid_file(fname, "ugrid") == NULL);
+    std::remove(fname);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
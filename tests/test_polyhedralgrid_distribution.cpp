@@ -0,0 +1,218 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define NVERBOSE  // Suppress own messages when throw()ing
+
+#define BOOST_TEST_MODULE PolyhedralGridDistributionTest
+#define BOOST_TEST_NO_MAIN
+#include <boost/test/unit_test.hpp>
+
+/* --- our own headers --- */
+#include <opm/grid/polyhedralgrid.hh>
+#include <opm/grid/cornerpoint_grid.h>
+#include <opm/grid/utility/SyntheticCornerPointModel.hpp>
+
+#include <vector>
+
+namespace
+{
+    typedef Dune::PolyhedralGrid<3, 3> Grid;
+
+    /// Sends one value per cell. The values are gathered from source and
+    /// scattered to target, either replacing or adding to its values.
+    class CellValueHandle
+        : public Dune::CommDataHandleIF<CellValueHandle, double>
+    {
+    public:
+        CellValueHandle(const Grid& grid, const std::vector<double>& source,
+                        std::vector<double>& target, bool add)
+            : grid_(grid), source_(source), target_(target), add_(add)
+        {}
+
+        bool contains(int /*dim*/, int codim) const
+        {
+            return codim == 0;
+        }
+        bool fixedsize(int /*dim*/, int /*codim*/) const
+        {
+            return true;
+        }
+        bool fixedSize(int /*dim*/, int /*codim*/) const
+        {
+            return true;
+        }
+        template<class E>
+        std::size_t size(const E&) const
+        {
+            return 1;
+        }
+        template<class B, class E>
+        void gather(B& buffer, const E& e) const
+        {
+            buffer.write(source_[grid_.leafIndexSet().index(e)]);
+        }
+        template<class B, class E>
+        void scatter(B& buffer, const E& e, std::size_t n)
+        {
+            BOOST_CHECK_EQUAL(n, std::size_t(1));
+            double value;
+            buffer.read(value);
+            const std::size_t i = grid_.leafIndexSet().index(e);
+            if (i >= target_.size()) {
+                target_.resize(i + 1, 0.0);
+            }
+            target_[i] = add_ ? target_[i] + value : value;
+        }
+
+    private:
+        const Grid& grid_;
+        const std::vector<double>& source_;
+        std::vector<double>& target_;
+        bool add_;
+    };
+
+    struct Fixture
+    {
+        Fixture()
+            : model(parameters()),
+              input(model.input()),
+              ug(create_grid_cornerpoint(&input, 0.0)),
+              grid(*ug),
+              num_global_cells(grid.size(0))
+        {}
+        ~Fixture() { destroy_grid(ug); }
+
+        static Opm::SyntheticCornerPointParameters parameters()
+        {
+            Opm::SyntheticCornerPointParameters params;
+            params.dims = {{ 8, 6, 5 }};
+            return params;
+        }
+
+        Opm::SyntheticCornerPointModel model;
+        grdecl input;
+        UnstructuredGrid* ug;
+        Grid grid;
+        int num_global_cells;
+    };
+}
+
+BOOST_FIXTURE_TEST_CASE(partitionIteration, Fixture)
+{
+    const auto& cc = Dune::MPIHelper::getCollectiveCommunication();
+    BOOST_CHECK_EQUAL(grid.loadBalance(), cc.size() > 1);
+
+    // The owned cells precede the overlap cells.
+    const auto& view = grid.leafGridView();
+    int interior = 0;
+    double interior_global_sum = 0.0;
+    for (auto it = view.begin<0, Dune::Interior_Partition>();
+         it != view.end<0, Dune::Interior_Partition>(); ++it, ++interior) {
+        BOOST_CHECK_EQUAL(it->partitionType(), Dune::InteriorEntity);
+        BOOST_CHECK_EQUAL(view.indexSet().index(*it), interior);
+        interior_global_sum += grid.globalCell()[interior];
+    }
+    int all = 0;
+    for (auto it = view.begin<0, Dune::All_Partition>();
+         it != view.end<0, Dune::All_Partition>(); ++it, ++all) {
+        BOOST_CHECK_EQUAL(it->partitionType(),
+                          all < interior ? Dune::InteriorEntity : Dune::OverlapEntity);
+    }
+    BOOST_CHECK_EQUAL(all, grid.size(0));
+    BOOST_CHECK(view.begin<0, Dune::Ghost_Partition>() == view.end<0, Dune::Ghost_Partition>());
+
+    // Every cell is owned by exactly one process.
+    BOOST_CHECK_EQUAL(cc.sum(interior), num_global_cells);
+    BOOST_CHECK_EQUAL(cc.sum(interior_global_sum),
+                      0.5 * num_global_cells * (num_global_cells - 1));
+    if (cc.size() > 1) {
+        BOOST_CHECK(all > interior);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(cellDataExchange, Fixture)
+{
+    grid.loadBalance();
+    const auto& view = grid.leafGridView();
+    const int num_cells = grid.size(0);
+    int num_owned = 0;
+    for (auto it = view.begin<0, Dune::Interior_Partition>();
+         it != view.end<0, Dune::Interior_Partition>(); ++it) {
+        ++num_owned;
+    }
+
+    // The owners send their values to the overlap cells.
+    std::vector<double> values(num_cells, -1.0);
+    for (int c = 0; c < num_owned; ++c) {
+        values[c] = grid.globalCell()[c];
+    }
+    std::vector<double> received(values);
+    CellValueHandle owner_to_overlap(grid, values, received, false);
+    view.communicate(owner_to_overlap, Dune::InteriorBorder_All_Interface,
+                     Dune::ForwardCommunication);
+    for (int c = 0; c < num_cells; ++c) {
+        BOOST_CHECK_EQUAL(received[c], grid.globalCell()[c]);
+    }
+
+    // Counting the copies of each cell with All_All_Interface gives the
+    // same count on each copy.
+    const std::vector<double> ones(num_cells, 1.0);
+    std::vector<double> copies(ones);
+    CellValueHandle count(grid, ones, copies, true);
+    grid.communicate(count, Dune::All_All_Interface, Dune::ForwardCommunication);
+    std::vector<double> owner_copies(copies);
+    CellValueHandle copies_to_overlap(grid, copies, owner_copies, false);
+    grid.communicate(copies_to_overlap, Dune::InteriorBorder_All_Interface,
+                     Dune::ForwardCommunication);
+    for (int c = 0; c < num_cells; ++c) {
+        BOOST_CHECK_EQUAL(copies[c], owner_copies[c]);
+        BOOST_CHECK(copies[c] >= (c < num_owned ? 1.0 : 2.0));
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(loadBalanceWithData, Fixture)
+{
+    std::vector<double> global_values(num_global_cells);
+    for (int c = 0; c < num_global_cells; ++c) {
+        global_values[c] = 10.0 * grid.globalCell()[c];
+    }
+    std::vector<double> local_values;
+    CellValueHandle handle(grid, global_values, local_values, false);
+    if (grid.loadBalance(handle)) {
+        BOOST_REQUIRE_EQUAL(local_values.size(), std::size_t(grid.size(0)));
+        for (int c = 0; c < grid.size(0); ++c) {
+            BOOST_CHECK_EQUAL(local_values[c], 10.0 * grid.globalCell()[c]);
+        }
+    } else {
+        BOOST_CHECK(local_values.empty());
+    }
+}
+
+bool
+init_unit_test_func()
+{
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    boost::unit_test::unit_test_main(&init_unit_test_func,
+                                     argc, argv);
+}
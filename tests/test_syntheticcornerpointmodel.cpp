@@ -0,0 +1,84 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define NVERBOSE // to suppress our messages when throwing
+
+#define BOOST_TEST_MODULE SyntheticCornerPointModelTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/grid/utility/SyntheticCornerPointModel.hpp>
+
+#include <algorithm>
+
+namespace
+{
+    int numActiveCells(const Opm::SyntheticCornerPointModel& model)
+    {
+        grdecl g = model.input();
+        processed_grid output;
+        process_grdecl(&g, 0.0, &output);
+        const int num_cells = output.number_of_cells;
+        free_processed_grid(&output);
+        return num_cells;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(cartesian)
+{
+    Opm::SyntheticCornerPointParameters params;
+    params.dims = {{ 4, 3, 2 }};
+    params.cellsize = {{ 1.0, 2.0, 3.0 }};
+    Opm::SyntheticCornerPointModel model(params);
+
+    BOOST_CHECK_EQUAL(model.coord().size(), std::size_t(6*5*4));
+    BOOST_CHECK_EQUAL(model.zcorn().size(), std::size_t(8*4*3*2));
+    BOOST_CHECK_EQUAL(model.actnum().size(), std::size_t(4*3*2));
+    BOOST_CHECK(std::all_of(model.actnum().begin(), model.actnum().end(),
+                            [](int active) { return active == 1; }));
+    // The top of the first layer is the bottom of the second one.
+    BOOST_CHECK_EQUAL(model.zcorn()[0], 0.0);
+    BOOST_CHECK_EQUAL(model.zcorn()[4*4*3], 3.0);
+    BOOST_CHECK_EQUAL(model.zcorn()[2*4*4*3], 3.0);
+    BOOST_CHECK_EQUAL(model.zcorn().back(), 6.0);
+    BOOST_CHECK_EQUAL(numActiveCells(model), 4*3*2);
+}
+
+BOOST_AUTO_TEST_CASE(deformed)
+{
+    Opm::SyntheticCornerPointParameters params;
+    params.dims = {{ 20, 15, 6 }};
+    params.cellsize = {{ 10.0, 10.0, 2.0 }};
+    params.fault_density = 0.2;
+    params.fault_throw = 1.5;
+    params.pillar_slope = 0.3;
+    Opm::SyntheticCornerPointModel faulted(params);
+    BOOST_CHECK_EQUAL(numActiveCells(faulted), 20*15*6);
+
+    params.inactive_fraction = 0.1;
+    params.pinchout_fraction = 0.1;
+    Opm::SyntheticCornerPointModel pinched(params);
+    const int num_active = std::count(pinched.actnum().begin(), pinched.actnum().end(), 1);
+    BOOST_CHECK(num_active < 20*15*6);
+    BOOST_CHECK(numActiveCells(pinched) <= num_active);
+
+    // The same seed gives the same model.
+    Opm::SyntheticCornerPointModel again(params);
+    BOOST_CHECK(again.zcorn() == pinched.zcorn());
+    BOOST_CHECK(again.actnum() == pinched.actnum());
+}
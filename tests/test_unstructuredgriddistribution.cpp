@@ -0,0 +1,118 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define NVERBOSE  // Suppress own messages when throw()ing
+
+#define BOOST_TEST_MODULE UnstructuredGridDistributionTest
+#include <boost/test/unit_test.hpp>
+
+/* --- our own headers --- */
+#include <opm/grid/cart_grid.h>
+#include <opm/grid/UnstructuredGrid.h>
+#include <opm/grid/common/UnstructuredGridDistribution.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    struct Fixture
+    {
+        Fixture() : grid(create_grid_hexa3d(8, 6, 5, 1.0, 1.0, 1.0)) {}
+        ~Fixture() { destroy_grid(grid); }
+        UnstructuredGrid* grid;
+    };
+}
+
+BOOST_FIXTURE_TEST_CASE(partitionIsBalanced, Fixture)
+{
+    const int num_parts = 3;
+    const std::vector<int> part = Opm::partitionCellsByCoordinates(*grid, num_parts);
+    BOOST_REQUIRE_EQUAL(part.size(), std::size_t(grid->number_of_cells));
+    for (int p = 0; p < num_parts; ++p) {
+        const auto count = std::count(part.begin(), part.end(), p);
+        BOOST_CHECK_EQUAL(count, grid->number_of_cells / num_parts);
+    }
+    BOOST_CHECK(part == Opm::partitionCellsByCoordinates(*grid, num_parts));
+}
+
+BOOST_FIXTURE_TEST_CASE(distributionIsConsistent, Fixture)
+{
+    const int num_parts = 4;
+    const std::vector<int> part = Opm::partitionCellsByCoordinates(*grid, num_parts);
+    std::vector<Opm::UnstructuredGridDistribution> dist;
+    for (int p = 0; p < num_parts; ++p) {
+        dist.push_back(Opm::distributeUnstructuredGrid(*grid, part, p));
+    }
+
+    std::vector<int> owners(grid->number_of_cells, 0);
+    for (int p = 0; p < num_parts; ++p) {
+        const auto& d = dist[p];
+        for (std::size_t i = 0; i < d.global_cell_index.size(); ++i) {
+            const int c = d.global_cell_index[i];
+            const bool owned = int(i) < d.num_owned;
+            BOOST_CHECK_EQUAL(part[c] == p, owned);
+            owners[c] += owned;
+        }
+        // Each overlap list matches the owner list of the other process.
+        for (const auto& proc_cells : d.owner_overlap) {
+            const int q = proc_cells.first;
+            const auto& other = dist[q].owner_overlap.at(p).first;
+            BOOST_REQUIRE_EQUAL(proc_cells.second.second.size(), other.size());
+            for (std::size_t i = 0; i < other.size(); ++i) {
+                BOOST_CHECK_EQUAL(d.global_cell_index[proc_cells.second.second[i]],
+                                  dist[q].global_cell_index[other[i]]);
+            }
+        }
+        for (const auto& proc_cells : d.all_all) {
+            const auto& other = dist[proc_cells.first].all_all.at(p);
+            BOOST_REQUIRE_EQUAL(proc_cells.second.size(), other.size());
+            for (std::size_t i = 0; i < other.size(); ++i) {
+                BOOST_CHECK_EQUAL(d.global_cell_index[proc_cells.second[i]],
+                                  dist[proc_cells.first].global_cell_index[other[i]]);
+            }
+        }
+    }
+    BOOST_CHECK(std::all_of(owners.begin(), owners.end(), [](int n) { return n == 1; }));
+}
+
+BOOST_FIXTURE_TEST_CASE(subGrid, Fixture)
+{
+    const std::vector<int> cells = { 3, 4, 11 };
+    UnstructuredGrid* sub = Opm::extractSubGrid(*grid, cells);
+    BOOST_REQUIRE(sub != NULL);
+    BOOST_CHECK_EQUAL(sub->number_of_cells, 3);
+    BOOST_CHECK_EQUAL(sub->cell_facepos[3], 18);
+    // Cells 3 and 4 share a face, cell 11 is the J neighbour of 3.
+    BOOST_CHECK_EQUAL(sub->number_of_faces, 18 - 2);
+    BOOST_CHECK(sub->cell_facetag != NULL);
+    int interior_faces = 0;
+    for (int f = 0; f < sub->number_of_faces; ++f) {
+        interior_faces += sub->face_cells[2*f] >= 0 && sub->face_cells[2*f + 1] >= 0;
+    }
+    BOOST_CHECK_EQUAL(interior_faces, 2);
+    for (int c = 0; c < 3; ++c) {
+        BOOST_CHECK_EQUAL(sub->global_cell[c], cells[c]);
+        BOOST_CHECK_EQUAL(sub->cell_volumes[c], grid->cell_volumes[cells[c]]);
+        for (int d = 0; d < 3; ++d) {
+            BOOST_CHECK_EQUAL(sub->cell_centroids[3*c + d], grid->cell_centroids[3*cells[c] + d]);
+        }
+    }
+    destroy_grid(sub);
+}